@@ -0,0 +1,118 @@
+/*
+ * Measure how long it takes to fuzzy match a query against a large set of
+ * candidates after each key press, as the query is typed.
+ */
+#include "minirl.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_CANDIDATES 100000
+#define NUM_BEST 10
+#define NUM_RUNS 5
+#define MAX_CANDIDATE_LEN 64
+
+static char const * const words[] = {
+	"interface", "ethernet", "config", "system", "route", "static",
+	"firewall", "policy", "address", "vlan", "bridge", "status",
+	"counters", "neighbor", "tunnel", "wireless", "radio", "modem",
+};
+
+static uint32_t
+next_random(uint32_t * const state)
+{
+	*state = *state * 1103515245u + 12345u;
+
+	return *state >> 16;
+}
+
+static double
+elapsed_ms(struct timespec const * const start, struct timespec const * const end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e3
+		+ (end->tv_nsec - start->tv_nsec) / 1e6;
+}
+
+int
+main(int argc, char **argv)
+{
+	char const * const query = (argc > 1) ? argv[1] : "ifcfgstatus";
+	size_t const num_words = sizeof words / sizeof words[0];
+	minirl_span_st *candidates = malloc(sizeof(*candidates) * NUM_CANDIDATES);
+	int *scores = malloc(sizeof(*scores) * NUM_CANDIDATES);
+	char *text = malloc(NUM_CANDIDATES * MAX_CANDIDATE_LEN);
+	uint32_t state = 1;
+
+	if (candidates == NULL || scores == NULL || text == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	/* Build candidates like "system/route-static/neighbor42". */
+	for (size_t i = 0; i < NUM_CANDIDATES; i++) {
+		char * const s = text + i * MAX_CANDIDATE_LEN;
+		char const * const a = words[next_random(&state) % num_words];
+		char const * const b = words[next_random(&state) % num_words];
+		char const * const c = words[next_random(&state) % num_words];
+		char const * const d = words[next_random(&state) % num_words];
+		unsigned const n = next_random(&state) % 100;
+
+		candidates[i].s = s;
+		candidates[i].len = snprintf(s, MAX_CANDIDATE_LEN, "%s/%s-%s/%s%u", a, b, c, d, n);
+	}
+
+	printf("%zu candidates, query \"%s\"\n", (size_t)NUM_CANDIDATES, query);
+	printf("%-20s %8s %10s\n", "typed", "matches", "ms");
+
+	double worst = 0;
+
+	for (size_t typed = 1; typed <= strlen(query); typed++) {
+		char prefix[64];
+		size_t matches = 0;
+		double best_ms = 0;
+
+		snprintf(prefix, sizeof prefix, "%.*s", (int)typed, query);
+
+		/* Take the fastest of a few runs, to discount other load. */
+		for (size_t run = 0; run < NUM_RUNS; run++) {
+			int best[NUM_BEST] = { 0 };
+			struct timespec start;
+			struct timespec end;
+
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			matches = minirl_fuzzy_scores(prefix, candidates, NUM_CANDIDATES, scores);
+			/* Keep the best few scores, as a completion would. */
+			for (size_t i = 0; i < NUM_CANDIDATES; i++) {
+				for (size_t j = 0; j < NUM_BEST; j++) {
+					if (scores[i] > best[j]) {
+						memmove(&best[j + 1], &best[j],
+							sizeof(best[0]) * (NUM_BEST - 1 - j));
+						best[j] = scores[i];
+						break;
+					}
+				}
+			}
+			clock_gettime(CLOCK_MONOTONIC, &end);
+
+			double const ms = elapsed_ms(&start, &end);
+
+			if (run == 0 || ms < best_ms) {
+				best_ms = ms;
+			}
+		}
+
+		if (worst < best_ms) {
+			worst = best_ms;
+		}
+		printf("%-20s %8zu %10.3f\n", prefix, matches, best_ms);
+	}
+	printf("worst case per key press: %.3f ms\n", worst);
+
+	free(text);
+	free(scores);
+	free(candidates);
+
+	return EXIT_SUCCESS;
+}
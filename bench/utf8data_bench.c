@@ -0,0 +1,215 @@
+/*
+ * Measure how fast codepoints can be looked up in the Unicode tables built
+ * with a given layout, for text in a few different scripts.
+ * It's built once for each layout, as each has its own copy of utf8data.c.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "utf8data.c"
+
+#define NUM_CODEPOINTS (1 << 20)
+#define NUM_RUNS 5
+
+#ifndef UTF8DATA_LAYOUT
+#define UTF8DATA_LAYOUT "default"
+#endif
+
+/* The ranges codepoints are picked from for each kind of text. */
+typedef struct range_st {
+	uint32_t first;
+	uint32_t last;
+} range_st;
+
+typedef struct workload_st {
+	char const *name;
+	range_st const *ranges;
+	size_t num_ranges;
+} workload_st;
+
+static range_st const latin[] = {
+	{ 0x20, 0x7e }, { 0xa0, 0xff }, { 0x100, 0x17f },
+};
+static range_st const mixed[] = {
+	{ 0x20, 0x7e }, { 0x391, 0x3c9 }, { 0x410, 0x44f }, { 0x5d0, 0x5ea },
+	{ 0x627, 0x64a }, { 0x905, 0x939 }, { 0xe01, 0xe30 },
+};
+static range_st const cjk[] = {
+	{ 0x3041, 0x3096 }, { 0x30a1, 0x30fa }, { 0x4e00, 0x9fff }, { 0xac00, 0xd7a3 },
+};
+static range_st const emoji[] = {
+	{ 0x1f300, 0x1f5ff }, { 0x1f600, 0x1f64f }, { 0x1f900, 0x1f9ff }, { 0x2600, 0x26ff },
+};
+static range_st const any[] = {
+	{ 0x100, 0x10ffff },
+};
+
+#define WORKLOAD(name, ranges) { name, ranges, sizeof(ranges) / sizeof(ranges[0]) }
+
+static workload_st const workloads[] = {
+	WORKLOAD("latin", latin),
+	WORKLOAD("mixed", mixed),
+	WORKLOAD("cjk", cjk),
+	WORKLOAD("emoji", emoji),
+	WORKLOAD("any", any),
+};
+
+/* The tables that make up the layout, and their sizes. */
+typedef struct table_st {
+	char const *name;
+	size_t size;
+} table_st;
+
+#define TABLE(table) { #table, sizeof(table) }
+
+/* The same lookup as utf8_props() in utf8.c. */
+#ifdef UTF8DATA_COMPACT
+static uint8_t
+props_lookup(uint32_t const c)
+{
+	size_t lo = 0;
+	size_t hi;
+
+	if (c < 0x100) {
+		return props_latin1[c];
+	}
+	if (c < 0x10000) {
+		hi = sizeof(props_bmp_start) / sizeof(props_bmp_start[0]);
+		while (hi - lo > 1) {
+			size_t const mid = (lo + hi) / 2;
+
+			if (props_bmp_start[mid] <= c) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+		return props_bmp[lo];
+	}
+	if (c >= 0x110000) {
+		return 0;
+	}
+	hi = sizeof(props_astral) / sizeof(props_astral[0]);
+	while (hi - lo > 1) {
+		size_t const mid = (lo + hi) / 2;
+
+		if (props_astral[mid] >> 8 <= c) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return props_astral[lo] & 0xff;
+}
+
+static table_st const tables[] = {
+	TABLE(props_bmp_start), TABLE(props_bmp), TABLE(props_astral), TABLE(props_latin1),
+};
+#else
+static uint8_t
+props_lookup(uint32_t const c)
+{
+	unsigned i;
+
+	if (c < 0x100) {
+		return props_latin1[c];
+	}
+	if (c >= 0x110000) {
+		return 0;
+	}
+	i = props0[c >> props0_shift];
+	i = props1[i][(c >> props1_shift) & props1_mask];
+
+	return props2[i][c & props2_mask];
+}
+
+static table_st const tables[] = {
+	TABLE(props0), TABLE(props1), TABLE(props2), TABLE(props_latin1),
+};
+#endif
+
+static uint32_t
+next_random(uint32_t * const state)
+{
+	*state = *state * 1103515245u + 12345u;
+
+	return *state >> 8;
+}
+
+static double
+elapsed_ns(struct timespec const * const start, struct timespec const * const end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+int
+main(void)
+{
+	uint32_t * const codepoints = malloc(sizeof(*codepoints) * NUM_CODEPOINTS);
+	size_t table_size = 0;
+	uint32_t state = 1;
+
+	if (codepoints == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	/* The state machine isn't measured here. */
+	(void)grapheme_dfa;
+	(void)grapheme_dfa_break;
+	(void)grapheme_dfa_state_mask;
+
+	for (size_t t = 0; t < sizeof(tables) / sizeof(tables[0]); t++) {
+		table_size += tables[t].size;
+	}
+	printf("layout %s: %zu bytes (", UTF8DATA_LAYOUT, table_size);
+	for (size_t t = 0; t < sizeof(tables) / sizeof(tables[0]); t++) {
+		printf("%s%s %zu", (t > 0) ? ", " : "", tables[t].name, tables[t].size);
+	}
+	printf(")\n");
+	printf("%-10s %12s\n", "text", "ns/lookup");
+
+	for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+		workload_st const * const workload = &workloads[w];
+		unsigned sum = 0;
+		double best_ns = 0;
+
+		for (size_t i = 0; i < NUM_CODEPOINTS; i++) {
+			range_st const * const range =
+				&workload->ranges[next_random(&state) % workload->num_ranges];
+
+			codepoints[i] = range->first
+				+ next_random(&state) % (range->last - range->first + 1);
+		}
+
+		/* Take the fastest of a few runs, to discount other load. */
+		for (size_t run = 0; run < NUM_RUNS; run++) {
+			struct timespec start;
+			struct timespec end;
+
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for (size_t i = 0; i < NUM_CODEPOINTS; i++) {
+				uint8_t const props = props_lookup(codepoints[i]);
+
+				sum += (props & props_width_mask)
+					+ ((props >> props_break_shift) & props_break_mask);
+			}
+			clock_gettime(CLOCK_MONOTONIC, &end);
+
+			double const ns = elapsed_ns(&start, &end) / NUM_CODEPOINTS;
+
+			if (run == 0 || ns < best_ns) {
+				best_ns = ns;
+			}
+		}
+		/* Print the sum so that the lookups can't be optimised away. */
+		printf("%-10s %12.2f  (%u)\n", workload->name, best_ns, sum);
+	}
+
+	free(codepoints);
+
+	return EXIT_SUCCESS;
+}
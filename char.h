@@ -1,14 +1,127 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include "utils.h"
+
+#define FIRST_PRINTABLE_ASCII 0x20
+#define MAX_ASCII 0x7f
+
+/*
+ * Whether 'c' is an ASCII character that is a grapheme cluster by itself and
+ * has the same width whether or not UTF-8 is enabled. This excludes CR, which
+ * joins with a following LF, and DEL, which has no width as UTF-8.
+ * Text made only of these can be handled a byte at a time.
+ */
+static inline bool
+char_is_plain_ascii(char const c)
+{
+	return (c & 0x80) == 0 && c != '\r' && c != MAX_ASCII;
+}
+
+static inline size_t
+ascii_char_next(char const * const s, size_t const len, size_t const point)
+{
+	UNUSED_ARG(s);
+
+	if (point >= len) {
+		return len;
+	}
+
+	return point + 1;
+}
+
+static inline size_t
+ascii_char_prev(char const * const s, size_t const len, size_t const point)
+{
+	UNUSED_ARG(s);
+	UNUSED_ARG(len);
+
+	if (point <= 0) {
+		return 0;
+	}
+
+	return point - 1;
+}
+
+static inline size_t
+ascii_char_width(char const * const s, size_t const len, size_t const point)
+{
+	UNUSED_ARG(len);
+
+	if (s[point] >= FIRST_PRINTABLE_ASCII && s[point] <= MAX_ASCII) {
+		return 1;
+	}
+
+	return 0;
+}
+
+static inline size_t
+ascii_grapheme_width(
+	char const * const s,
+	size_t const len,
+	size_t const point,
+	size_t * const pnext)
+{
+	if (pnext != NULL) {
+		*pnext = ascii_char_next(s, len, point);
+	}
+
+	return ascii_char_width(s, len, point);
+}
+
+/*
+ * Whether the byte 'c' is part of a word, which is made of letters, digits
+ * and '_'. Any byte outside ASCII counts too, as it may be part of a letter.
+ */
+static inline bool
+ascii_is_word_char(char const c)
+{
+	return (c & 0x80) != 0
+		|| (c >= '0' && c <= '9')
+		|| (c >= 'A' && c <= 'Z')
+		|| (c >= 'a' && c <= 'z')
+		|| c == '_';
+}
+
+static inline size_t
+ascii_word_next(char const * const s, size_t const len, size_t point)
+{
+	while (point < len && !ascii_is_word_char(s[point])) {
+		point++;
+	}
+	while (point < len && ascii_is_word_char(s[point])) {
+		point++;
+	}
+
+	return point;
+}
+
+static inline size_t
+ascii_word_prev(char const * const s, size_t const len, size_t point)
+{
+	UNUSED_ARG(len);
+
+	while (point > 0 && !ascii_is_word_char(s[point - 1])) {
+		point--;
+	}
+	while (point > 0 && ascii_is_word_char(s[point - 1])) {
+		point--;
+	}
+
+	return point;
+}
+
 #ifndef DISABLE_UTF8
 
 #include "utf8.h"
 
 #define MAX_UTF8_LEN 4
 #define MAX_CHAR_LEN MAX_UTF8_LEN
+/* U+FFFD, which takes the place of invalid input. */
+#define CHAR_REPLACEMENT "\xef\xbf\xbd"
 
 static inline size_t
 char_len(char const c)
@@ -67,11 +180,95 @@ grapheme_width(
 	return utf8_grapheme_width(s, len, point, pnext);
 }
 
-#else
+/*
+ * Get the end of the word after 'point', passing over any spaces and
+ * punctuation before it.
+ */
+static inline size_t
+word_next(char const * const s, size_t const len, size_t const point)
+{
+	return utf8_word_next(s, len, point);
+}
 
-#include "utils.h"
+/* Get the start of the word before 'point'. */
+static inline size_t
+word_prev(char const * const s, size_t const len, size_t const point)
+{
+	return utf8_word_prev(s, len, point);
+}
+
+typedef struct utf8_grapheme_cursor grapheme_cursor_st;
+
+static inline void
+grapheme_cursor_init(
+	grapheme_cursor_st * const cursor,
+	char const * const s,
+	size_t const len,
+	size_t const point)
+{
+	utf8_grapheme_cursor_init(cursor, s, len, point);
+}
+
+/*
+ * Get the start, end and width of the grapheme cluster after the cursor,
+ * and move the cursor past it. Returns false at the end of the string.
+ */
+static inline bool
+grapheme_cursor_next(
+	grapheme_cursor_st * const cursor,
+	size_t * const start,
+	size_t * const end,
+	size_t * const width)
+{
+	return utf8_grapheme_cursor_next(cursor, start, end, width);
+}
+
+/*
+ * As grapheme_cursor_next(), but for the cluster before the cursor.
+ * Returns false at the start of the string.
+ */
+static inline bool
+grapheme_cursor_prev(
+	grapheme_cursor_st * const cursor,
+	size_t * const start,
+	size_t * const end,
+	size_t * const width)
+{
+	return utf8_grapheme_cursor_prev(cursor, start, end, width);
+}
+
+/*
+ * Get the end of the run of characters from 'point' that are each one column
+ * wide and a grapheme cluster by themselves, i.e. printable ASCII characters
+ * that aren't followed by a character that could combine with them.
+ */
+static inline size_t
+char_ascii_run(char const * const s, size_t const len, size_t const point)
+{
+	size_t end = utf8_ascii_run(s, len, point);
+
+	if (end > point && end < len && (s[end] & 0x80) != 0) {
+		/* The last may start a grapheme cluster with what follows. */
+		end--;
+	}
+
+	return end;
+}
+
+/*
+ * Get the end of the run of valid characters from 'point', which is either
+ * 'len' or the start of the first invalid or incomplete one.
+ */
+static inline size_t
+char_valid_run(char const * const s, size_t const len, size_t const point)
+{
+	return utf8_valid_run(s, len, point);
+}
+
+#else
 
 #define MAX_CHAR_LEN 1
+#define CHAR_REPLACEMENT "?"
 
 static inline size_t
 char_len(char const c)
@@ -107,51 +304,31 @@ char_encode(uint32_t const c, char * const s, size_t const len)
 static inline size_t
 char_next(char const * const s, size_t const len, size_t const point)
 {
-	UNUSED_ARG(s);
-
-	if (point >= len) {
-		return len;
-	}
-
-	return point + 1;
+	return ascii_char_next(s, len, point);
 }
 
 static inline size_t
 char_prev(char const * const s, size_t const len, size_t const point)
 {
-	UNUSED_ARG(s);
-	UNUSED_ARG(len);
-
-	if (point <= 0) {
-		return 0;
-	}
-
-	return point - 1;
+	return ascii_char_prev(s, len, point);
 }
 
 static inline size_t
 char_width(char const * const s, size_t const len, size_t const point)
 {
-#define FIRST_PRINTABLE_ASCII 0x20
-#define MAX_ASCII 0x7f
-
-	if (s[point] >= FIRST_PRINTABLE_ASCII && s[point] <= MAX_ASCII) {
-		return 1;
-	}
-
-	return 0;
+	return ascii_char_width(s, len, point);
 }
 
 static inline size_t
 grapheme_next(char const * const s, size_t const len, size_t const point)
 {
-	return char_next(s, len, point);
+	return ascii_char_next(s, len, point);
 }
 
 static inline size_t
 grapheme_prev(char const * const s, size_t const len, size_t const point)
 {
-	return char_prev(s, len, point);
+	return ascii_char_prev(s, len, point);
 }
 
 static inline size_t
@@ -161,12 +338,96 @@ grapheme_width(
 	size_t const point,
 	size_t * const pnext)
 {
-	if (pnext != NULL) {
-		*pnext = char_next(s, len, point);
+	return ascii_grapheme_width(s, len, point, pnext);
+}
+
+static inline size_t
+word_next(char const * const s, size_t const len, size_t const point)
+{
+	return ascii_word_next(s, len, point);
+}
+
+static inline size_t
+word_prev(char const * const s, size_t const len, size_t const point)
+{
+	return ascii_word_prev(s, len, point);
+}
+
+typedef struct grapheme_cursor_st {
+	char const *s;
+	size_t len;
+	size_t point;
+} grapheme_cursor_st;
+
+static inline void
+grapheme_cursor_init(
+	grapheme_cursor_st * const cursor,
+	char const * const s,
+	size_t const len,
+	size_t const point)
+{
+	cursor->s = s;
+	cursor->len = len;
+	cursor->point = point;
+}
+
+static inline bool
+grapheme_cursor_next(
+	grapheme_cursor_st * const cursor,
+	size_t * const start,
+	size_t * const end,
+	size_t * const width)
+{
+	if (cursor->point >= cursor->len) {
+		return false;
 	}
+	*start = cursor->point;
+	*end = cursor->point + 1;
+	if (width != NULL) {
+		*width = char_width(cursor->s, cursor->len, cursor->point);
+	}
+	cursor->point = *end;
 
-	return char_width(s, len, point);
+	return true;
 }
 
-#endif
+static inline bool
+grapheme_cursor_prev(
+	grapheme_cursor_st * const cursor,
+	size_t * const start,
+	size_t * const end,
+	size_t * const width)
+{
+	if (cursor->point == 0) {
+		return false;
+	}
+	*end = cursor->point;
+	*start = cursor->point - 1;
+	if (width != NULL) {
+		*width = char_width(cursor->s, cursor->len, *start);
+	}
+	cursor->point = *start;
+
+	return true;
+}
+
+static inline size_t
+char_ascii_run(char const * const s, size_t const len, size_t point)
+{
+	while (point < len && s[point] >= FIRST_PRINTABLE_ASCII && s[point] < MAX_ASCII) {
+		point++;
+	}
+
+	return point;
+}
+
+static inline size_t
+char_valid_run(char const * const s, size_t const len, size_t const point)
+{
+	UNUSED_ARG(s);
+	UNUSED_ARG(point);
 
+	return len;
+}
+
+#endif
@@ -0,0 +1,247 @@
+#include "minirl.h"
+#include "complete.h"
+#include "export.h"
+#include "private.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define COMMAND_MIN_CHILDREN 4
+
+struct minirl_command_st {
+	char *name;
+	/*
+	 * The children are kept sorted by name, so those starting with a
+	 * given prefix are all together, and are found with a binary search.
+	 * Their names are also kept in an array of their own, in the same
+	 * order, so that a range of it can be used as the matches for a
+	 * completion as it is.
+	 */
+	minirl_command_st **children;
+	char **names;
+	size_t num_children;
+	size_t capacity;
+};
+
+/* Find the first child whose name doesn't sort before 'word'. */
+static size_t
+command_lower_bound(
+	minirl_command_st const * const node,
+	char const * const word,
+	size_t const len)
+{
+	size_t lo = 0;
+	size_t hi = node->num_children;
+
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+
+		if (strncmp(node->names[mid], word, len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Find the range of children whose names start with 'word'. */
+static size_t
+command_prefix_range(
+	minirl_command_st const * const node,
+	char const * const word,
+	size_t const len,
+	size_t * const end)
+{
+	size_t const start = command_lower_bound(node, word, len);
+
+	*end = start;
+	while (*end < node->num_children && strncmp(node->names[*end], word, len) == 0) {
+		(*end)++;
+	}
+
+	return start;
+}
+
+/*
+ * Find the child named 'word', or else the only child whose name starts
+ * with it, so that commands can be abbreviated.
+ */
+static minirl_command_st const *
+command_child_find(
+	minirl_command_st const * const node,
+	char const * const word,
+	size_t const len)
+{
+	size_t end;
+	size_t const start = command_prefix_range(node, word, len, &end);
+
+	if (start == end) {
+		return NULL;
+	}
+	/* An exact match sorts before any longer name it is a prefix of. */
+	if (node->names[start][len] == '\0' || end - start == 1) {
+		return node->children[start];
+	}
+
+	return NULL;
+}
+
+static bool
+command_children_grow(minirl_command_st * const node)
+{
+	size_t const capacity =
+		(node->capacity == 0) ? COMMAND_MIN_CHILDREN : node->capacity * 2;
+	minirl_command_st ** const children =
+		realloc(node->children, sizeof(*children) * capacity);
+
+	if (children == NULL) {
+		return false;
+	}
+	node->children = children;
+
+	/* Leave room for a NULL after the last name. */
+	char ** const names = realloc(node->names, sizeof(*names) * (capacity + 1));
+
+	if (names == NULL) {
+		return false;
+	}
+	node->names = names;
+	node->capacity = capacity;
+
+	return true;
+}
+
+minirl_command_st *
+minirl_command_tree_new(void)
+{
+	return calloc(1, sizeof(minirl_command_st));
+}
+
+void
+minirl_command_tree_free(minirl_command_st * const node)
+{
+	if (node == NULL) {
+		return;
+	}
+	for (size_t i = 0; i < node->num_children; i++) {
+		minirl_command_tree_free(node->children[i]);
+	}
+	free(node->children);
+	free(node->names);
+	free(node->name);
+	free(node);
+}
+
+minirl_command_st *
+minirl_command_add(minirl_command_st * const parent, char const * const name)
+{
+	size_t const len = strlen(name);
+
+	if (len == 0 || strchr(name, ' ') != NULL) {
+		return NULL;
+	}
+
+	size_t const index = command_lower_bound(parent, name, len + 1);
+
+	if (index < parent->num_children && strcmp(parent->names[index], name) == 0) {
+		return parent->children[index];
+	}
+
+	if (parent->num_children == parent->capacity && !command_children_grow(parent)) {
+		return NULL;
+	}
+
+	minirl_command_st * const child = calloc(1, sizeof(*child));
+
+	if (child == NULL) {
+		return NULL;
+	}
+	child->name = strdup(name);
+	if (child->name == NULL) {
+		free(child);
+		return NULL;
+	}
+
+	size_t const num_after = parent->num_children - index;
+
+	memmove(&parent->children[index + 1],
+		&parent->children[index],
+		sizeof(*parent->children) * num_after);
+	memmove(&parent->names[index + 1],
+		&parent->names[index],
+		sizeof(*parent->names) * num_after);
+	parent->children[index] = child;
+	parent->names[index] = child->name;
+	parent->num_children++;
+	parent->names[parent->num_children] = NULL;
+
+	return child;
+}
+
+bool
+minirl_complete_command(
+	minirl_st * const minirl,
+	minirl_command_st const * const root,
+	bool const allow_prefix)
+{
+	char const * const line = minirl_line_get(minirl);
+	size_t const point = minirl_point_get(minirl);
+	minirl_command_st const *node = root;
+	size_t start = 0;
+
+	/* Follow the words before the one being completed down the tree. */
+	for (size_t pos = 0; pos < point; pos++) {
+		if (line[pos] != ' ') {
+			continue;
+		}
+		if (pos > start) {
+			node = command_child_find(node, line + start, pos - start);
+			if (node == NULL) {
+				return false;
+			}
+		}
+		start = pos + 1;
+	}
+
+	size_t end;
+	size_t first;
+
+	if (minirl->options.fuzzy && point > start) {
+		/* Any of the children may fuzzy match the word, not just those it starts. */
+		first = 0;
+		end = node->num_children;
+	} else {
+		first = command_prefix_range(node, line + start, point - start, &end);
+	}
+
+	if (first == end) {
+		return false;
+	}
+
+	/*
+	 * As the names are sorted, the prefix common to them all is that of
+	 * the first and last, and if that prefix is itself a match, it's the
+	 * first.
+	 */
+	char const * const first_name = node->names[first];
+	char const * const last_name = node->names[end - 1];
+	unsigned len = 0;
+
+	while (first_name[len] != '\0' && first_name[len] == last_name[len]) {
+		len++;
+	}
+
+	complete_matches_st const matches = {
+		.strings = &node->names[first],
+		.count = end - first
+	};
+
+	return complete_common_prefix(minirl,
+				      start,
+				      &matches,
+				      len,
+				      first_name[len] == '\0',
+				      allow_prefix);
+}
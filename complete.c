@@ -0,0 +1,1249 @@
+#include "minirl.h"
+#include "char.h"
+#include "complete.h"
+#include "export.h"
+#include "fuzzy.h"
+#include "io.h"
+#include "private.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/ttydefaults.h>
+
+#define COMPLETE_ASYNC_NUM_THREADS 2
+/* Ask before displaying at least this many matches. */
+#define COMPLETE_DEFAULT_QUERY_ITEMS 100
+/* The number of spaces between columns of matches. */
+#define COMPLETE_COLUMN_GAP 2
+
+struct complete_request_st {
+	complete_request_st *next;
+	complete_async_st *async;
+	unsigned long serial;
+
+	/* A copy of the line when the request was made. */
+	char *line;
+	size_t len;
+	size_t point;
+
+	minirl_completion_cb cb;
+	void *user_ctx;
+	bool allow_prefix;
+
+	/* The results. */
+	unsigned start;
+	char **matches;
+};
+
+static void
+complete_matches_free(char ** const matches)
+{
+	if (matches == NULL) {
+		return;
+	}
+	for (char **m = matches; *m != NULL; m++) {
+		free(*m);
+	}
+	free(matches);
+}
+
+static void
+complete_request_free(complete_request_st * const request)
+{
+	complete_matches_free(request->matches);
+	free(request->line);
+	free(request);
+}
+
+static void
+complete_async_job(void * const arg)
+{
+	complete_request_st * const request = arg;
+	complete_async_st * const async = request->async;
+
+	/* Don't bother if a newer request has already been made. */
+	if (request->serial == atomic_load(&async->serial)) {
+		request->matches = request->cb(request->line,
+					       request->point,
+					       &request->start,
+					       request->user_ctx);
+	}
+
+	pthread_mutex_lock(&async->lock);
+	request->next = async->done;
+	async->done = request;
+	pthread_mutex_unlock(&async->lock);
+
+	uint64_t const one = 1;
+	ssize_t const res = io_write(async->event_fd, &one, sizeof one);
+
+	(void)res;
+}
+
+NO_EXPORT
+complete_async_st *
+complete_async_new(void)
+{
+	complete_async_st * const async = calloc(1, sizeof(*async));
+
+	if (async == NULL) {
+		return NULL;
+	}
+
+	async->event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (async->event_fd == -1) {
+		free(async);
+		return NULL;
+	}
+	if (pthread_mutex_init(&async->lock, NULL) != 0) {
+		close(async->event_fd);
+		free(async);
+		return NULL;
+	}
+
+	async->pool = worker_pool_new(COMPLETE_ASYNC_NUM_THREADS);
+	if (async->pool == NULL) {
+		pthread_mutex_destroy(&async->lock);
+		close(async->event_fd);
+		free(async);
+		return NULL;
+	}
+
+	return async;
+}
+
+NO_EXPORT
+void
+complete_async_free(complete_async_st * const async)
+{
+	if (async == NULL) {
+		return;
+	}
+
+	/*
+	 * Stop the workers first, as they add to the done list. Requests that
+	 * haven't started yet are dropped, but this waits for any callback
+	 * already running, so that none is still using its context once the
+	 * caller frees it.
+	 */
+	atomic_fetch_add(&async->serial, 1);
+	worker_pool_free(async->pool);
+
+	while (async->done != NULL) {
+		complete_request_st * const request = async->done;
+
+		async->done = request->next;
+		complete_request_free(request);
+	}
+	pthread_mutex_destroy(&async->lock);
+	close(async->event_fd);
+	free(async);
+}
+
+NO_EXPORT
+int
+complete_async_fd(minirl_st const * const minirl)
+{
+	return (minirl->async != NULL) ? minirl->async->event_fd : -1;
+}
+
+NO_EXPORT
+void
+complete_async_cancel(minirl_st * const minirl)
+{
+	if (minirl->async != NULL) {
+		atomic_fetch_add(&minirl->async->serial, 1);
+	}
+}
+
+static bool
+complete_request_is_current(
+	minirl_st const * const minirl,
+	complete_request_st const * const request)
+{
+	minirl_state_st const * const l = &minirl->state;
+
+	return request->serial == atomic_load(&minirl->async->serial)
+		&& !l->search.active
+		&& request->matches != NULL
+		&& request->start <= request->point
+		&& l->len == request->len
+		&& l->pos == request->point
+		&& memcmp(l->line_buf->b, request->line, l->len) == 0;
+}
+
+NO_EXPORT
+void
+complete_async_apply(minirl_st * const minirl)
+{
+	complete_async_st * const async = minirl->async;
+	uint64_t count;
+
+	if (io_read(async->event_fd, &count, sizeof count) == -1) {
+		/* Nothing to do. */
+	}
+
+	pthread_mutex_lock(&async->lock);
+	complete_request_st *done = async->done;
+	async->done = NULL;
+	pthread_mutex_unlock(&async->lock);
+
+	while (done != NULL) {
+		complete_request_st * const request = done;
+
+		done = request->next;
+		if (complete_request_is_current(minirl, request)) {
+			minirl_complete(minirl,
+					request->start,
+					request->matches,
+					request->allow_prefix);
+		}
+		complete_request_free(request);
+	}
+}
+
+static size_t
+complete_match_width(char const * const match, size_t const len)
+{
+	size_t width = 0;
+
+	for (size_t point = 0; point < len;) {
+		size_t const run_end = char_ascii_run(match, len, point);
+
+		if (run_end > point) {
+			width += run_end - point;
+			point = run_end;
+		} else {
+			width += grapheme_width(match, len, point, &point);
+		}
+	}
+
+	return width;
+}
+
+/*
+ * Lay the matches out in columns, ordered down each column and then across,
+ * using as many columns as will fit in 'term_width'. Each column is only as
+ * wide as its widest match.
+ */
+static bool
+complete_layout(
+	complete_layout_st * const layout,
+	size_t const * const widths,
+	size_t const count,
+	size_t const term_width)
+{
+	size_t min_width = SIZE_MAX;
+
+	*layout = (complete_layout_st){ 0 };
+	if (count == 0) {
+		return true;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (min_width > widths[i]) {
+			min_width = widths[i];
+		}
+	}
+
+	/* No more columns than there'd be room for with the narrowest matches. */
+	size_t max_cols = term_width / (min_width + COMPLETE_COLUMN_GAP);
+
+	if (max_cols > count) {
+		max_cols = count;
+	}
+	if (max_cols == 0) {
+		max_cols = 1;
+	}
+
+	layout->col_widths = malloc(sizeof(*layout->col_widths) * max_cols);
+	if (layout->col_widths == NULL) {
+		return false;
+	}
+
+	for (size_t cols = max_cols; cols > 0; cols--) {
+		size_t const rows = (count + cols - 1) / cols;
+		/* The columns actually used, as the last ones may be empty. */
+		size_t const used_cols = (count + rows - 1) / rows;
+		size_t total = 0;
+		size_t col;
+
+		for (col = 0; col < used_cols; col++) {
+			size_t col_width = 0;
+			size_t const end = (col + 1) * rows;
+
+			for (size_t i = col * rows; i < end && i < count; i++) {
+				if (col_width < widths[i]) {
+					col_width = widths[i];
+				}
+			}
+			layout->col_widths[col] = col_width;
+			total += col_width + ((col > 0) ? COMPLETE_COLUMN_GAP : 0);
+			if (total >= term_width && cols > 1) {
+				break;
+			}
+		}
+		if (col == used_cols || cols == 1) {
+			layout->num_cols = used_cols;
+			layout->num_rows = rows;
+			break;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Measure the matches and lay them out in columns to fit the terminal.
+ * On success the caller owns '*widths' and the layout's column widths.
+ */
+static bool
+complete_measure(
+	minirl_st * const minirl,
+	complete_matches_st const * const matches,
+	size_t ** const widths,
+	complete_layout_st * const layout)
+{
+	*widths = malloc(sizeof(**widths) * matches->count);
+	if (*widths == NULL) {
+		return false;
+	}
+	for (size_t i = 0; i < matches->count; i++) {
+		size_t len;
+		char const * const match = complete_match_get(matches, i, &len);
+
+		(*widths)[i] = complete_match_width(match, len);
+	}
+	if (!complete_layout(layout, *widths, matches->count, minirl_terminal_width(minirl))) {
+		free(*widths);
+		*widths = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+static void
+complete_display_rows(
+	struct buffer * const ab,
+	complete_matches_st const * const matches,
+	size_t const * const widths,
+	complete_layout_st const * const layout,
+	size_t const first_row,
+	size_t const num_rows)
+{
+	for (size_t row = first_row; row < first_row + num_rows; row++) {
+		for (size_t col = 0; col < layout->num_cols; col++) {
+			size_t const i = col * layout->num_rows + row;
+
+			if (i >= matches->count) {
+				break;
+			}
+
+			size_t len;
+			char const * const match = complete_match_get(matches, i, &len);
+
+			buffer_append(ab, match, len);
+
+			/* Pad out to the next column, if there's anything in it. */
+			if (i + layout->num_rows < matches->count) {
+				size_t const padding =
+					layout->col_widths[col] - widths[i] + COMPLETE_COLUMN_GAP;
+				char const spaces[] = "        ";
+
+				for (size_t j = 0; j < padding; j += sizeof spaces - 1) {
+					size_t const n = padding - j;
+
+					buffer_append(ab,
+						      spaces,
+						      (n < sizeof spaces - 1) ? n : sizeof spaces - 1);
+				}
+			}
+		}
+		buffer_append(ab, "\r\n", 2);
+	}
+}
+
+static void
+complete_write(minirl_st * const minirl, struct buffer const * const ab)
+{
+	if (io_write(minirl->out.fd, ab->b, ab->len) == -1) {
+		minirl_had_error(minirl);
+	}
+}
+
+static size_t
+complete_page_rows(minirl_st * const minirl)
+{
+	/* Leave a row for the --More-- prompt. */
+	int const height = minirl_terminal_height(minirl);
+
+	return (height > 1) ? height - 1 : 1;
+}
+
+/*
+ * Show the next 'num_rows' rows of matches, and then either prompt for more
+ * or end the display if there are none, after anything already in 'ab'.
+ */
+static void
+complete_pager_show(minirl_st * const minirl, struct buffer * const ab, size_t num_rows)
+{
+	complete_pager_st * const pager = &minirl->pager;
+	size_t const rows_left = pager->layout.num_rows - pager->next_row;
+
+	if (num_rows > rows_left) {
+		num_rows = rows_left;
+	}
+	complete_display_rows(ab,
+			      &pager->matches,
+			      pager->widths,
+			      &pager->layout,
+			      pager->next_row,
+			      num_rows);
+	pager->next_row += num_rows;
+
+	if (pager->next_row < pager->layout.num_rows) {
+		char const more[] = "--More--";
+
+		pager->state = COMPLETE_PAGER_MORE;
+		buffer_append(ab, more, strlen(more));
+	} else {
+		complete_pager_end(minirl);
+	}
+}
+
+static bool
+complete_pager_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	complete_pager_st * const pager = &minirl->pager;
+	char const c = key[0];
+	bool const quit = c == 'n' || c == 'N' || c == 'q' || c == 'Q'
+		|| c == CTRL('c') || c == CTRL('g');
+	struct buffer ab;
+
+	buffer_init(&ab, 0);
+
+	if (pager->state == COMPLETE_PAGER_QUERY) {
+		if (c == 'y' || c == 'Y' || c == ' ') {
+			buffer_append(&ab, "\r\n", 2);
+			if (complete_measure(minirl, &pager->matches, &pager->widths, &pager->layout)) {
+				complete_pager_show(minirl, &ab, complete_page_rows(minirl));
+			} else {
+				complete_pager_end(minirl);
+			}
+		} else if (quit || c == BACKSPACE) {
+			buffer_append(&ab, "\r\n", 2);
+			complete_pager_end(minirl);
+		}
+	} else if (pager->state == COMPLETE_PAGER_MORE) {
+		char const clear[] = "\r" ESCAPESTR "[0K";
+
+		if (c == ' ' || c == '\r' || c == 'j' || quit) {
+			/* Remove the --More-- prompt. */
+			buffer_append(&ab, clear, strlen(clear));
+		}
+		if (c == ' ') {
+			complete_pager_show(minirl, &ab, complete_page_rows(minirl));
+		} else if (c == '\r' || c == 'j') {
+			complete_pager_show(minirl, &ab, 1);
+		} else if (quit) {
+			complete_pager_end(minirl);
+		}
+	}
+
+	complete_write(minirl, &ab);
+	buffer_clear(&ab);
+
+	return true;
+}
+
+/* Copy the matches, as the caller may free them once completion is done. */
+static bool
+complete_pager_copy(complete_pager_st * const pager, complete_matches_st const * const matches)
+{
+	size_t total = 0;
+
+	for (size_t i = 0; i < matches->count; i++) {
+		size_t len;
+
+		complete_match_get(matches, i, &len);
+		total += len;
+	}
+
+	minirl_span_st * const spans = malloc(sizeof(*spans) * matches->count);
+
+	if (spans == NULL || !buffer_init(&pager->text, total)) {
+		free(spans);
+		return false;
+	}
+
+	for (size_t i = 0; i < matches->count; i++) {
+		spans[i].s = complete_match_get(matches, i, &spans[i].len);
+		buffer_append(&pager->text, spans[i].s, spans[i].len);
+	}
+	/* The text is only moved when the buffer grows, so set the pointers now. */
+	for (size_t i = 0, offset = 0; i < matches->count; offset += spans[i].len, i++) {
+		spans[i].s = pager->text.b + offset;
+	}
+	pager->matches = (complete_matches_st){
+		.spans = spans,
+		.count = matches->count
+	};
+
+	return true;
+}
+
+/* Take over a copy of the matches, and the keymap, for paging through them. */
+static bool
+complete_pager_start(minirl_st * const minirl, complete_matches_st const * const matches)
+{
+	complete_pager_st * const pager = &minirl->pager;
+
+	if (!complete_pager_copy(pager, matches)) {
+		return false;
+	}
+	pager->next_row = 0;
+	pager->saved_keymap = minirl->keymap;
+	minirl->keymap = pager->keymap;
+
+	return true;
+}
+
+/*
+ * Display the matches, a page at a time if there are too many to fit on
+ * the screen, asking first if there are a lot of them. They're only
+ * measured and laid out once the user has said to display them.
+ * Returns true if the display continues as keys are pressed.
+ */
+static bool
+complete_display(minirl_st * const minirl, complete_matches_st const * const matches)
+{
+	complete_pager_st * const pager = &minirl->pager;
+	complete_layout_st layout = { 0 };
+	size_t *widths = NULL;
+	bool paging = false;
+	struct buffer ab;
+
+	buffer_init(&ab, 0);
+	if (pager->state == COMPLETE_PAGER_MORE) {
+		/* Replace the --More-- prompt with the new matches. */
+		char const clear[] = "\r" ESCAPESTR "[0K";
+
+		buffer_append(&ab, clear, strlen(clear));
+	} else {
+		buffer_append(&ab, "\r\n", 2);
+	}
+	/* Stop paging through any earlier matches. */
+	complete_pager_end(minirl);
+
+	if (pager->query_items > 0 && matches->count >= pager->query_items) {
+		if (complete_pager_start(minirl, matches)) {
+			char buf[64];
+
+			pager->state = COMPLETE_PAGER_QUERY;
+			buffer_snprintf(&ab,
+					buf,
+					sizeof buf,
+					"Display all %zu possibilities? (y or n)",
+					matches->count);
+			paging = true;
+		}
+		goto done;
+	}
+
+	if (!complete_measure(minirl, matches, &widths, &layout)) {
+		goto done;
+	}
+
+	if (layout.num_rows > complete_page_rows(minirl)) {
+		if (!complete_pager_start(minirl, matches)) {
+			/* Rather than fill the screen with them, don't show any. */
+			goto done;
+		}
+		/* The pager takes over the widths and layout. */
+		pager->widths = widths;
+		pager->layout = layout;
+		widths = NULL;
+		layout = (complete_layout_st){ 0 };
+		complete_pager_show(minirl, &ab, complete_page_rows(minirl));
+		paging = pager->state != COMPLETE_PAGER_IDLE;
+		goto done;
+	}
+
+	/* Print out a table of completions. */
+	complete_display_rows(&ab, matches, widths, &layout, 0, layout.num_rows);
+
+done:
+	complete_write(minirl, &ab);
+	buffer_clear(&ab);
+	free(layout.col_widths);
+	free(widths);
+
+	return paging;
+}
+
+NO_EXPORT
+void
+complete_pager_end(minirl_st * const minirl)
+{
+	complete_pager_st * const pager = &minirl->pager;
+
+	if (pager->state == COMPLETE_PAGER_IDLE) {
+		return;
+	}
+	pager->state = COMPLETE_PAGER_IDLE;
+	minirl->keymap = pager->saved_keymap;
+	free((void *)pager->matches.spans);
+	pager->matches = (complete_matches_st){ 0 };
+	buffer_clear(&pager->text);
+	free(pager->widths);
+	pager->widths = NULL;
+	free(pager->layout.col_widths);
+	pager->layout = (complete_layout_st){ 0 };
+
+	/* Show the line afresh below the matches. */
+	minirl_line_state_reset(minirl);
+}
+
+NO_EXPORT
+bool
+complete_pager_init(minirl_st * const minirl)
+{
+	complete_pager_st * const pager = &minirl->pager;
+
+	pager->query_items = COMPLETE_DEFAULT_QUERY_ITEMS;
+	pager->keymap = minirl_keymap_new();
+	if (pager->keymap == NULL) {
+		return false;
+	}
+	for (size_t i = 0; i < KEYMAP_SIZE; i++) {
+		pager->keymap->keys[i].handler = complete_pager_handler;
+	}
+
+	return true;
+}
+
+NO_EXPORT
+void
+complete_pager_free(minirl_st * const minirl)
+{
+	complete_pager_end(minirl);
+	minirl_keymap_free(minirl->pager.keymap);
+	minirl->pager.keymap = NULL;
+}
+
+void
+minirl_complete_set_query_items(minirl_st * const minirl, size_t const query_items)
+{
+	minirl->pager.query_items = query_items;
+}
+
+void
+minirl_display_matches(minirl_st * const minirl, char ** const matches)
+{
+	complete_matches_st all = { .strings = matches };
+
+	while (matches[all.count] != NULL) {
+		all.count++;
+	}
+	complete_display(minirl, &all);
+}
+
+void
+minirl_display_spans(
+	minirl_st * const minirl,
+	minirl_span_st const * const matches,
+	size_t const count)
+{
+	complete_matches_st const all = { .spans = matches, .count = count };
+
+	complete_display(minirl, &all);
+}
+
+typedef struct complete_rank_st {
+	size_t index;
+	size_t len;
+	int score;
+} complete_rank_st;
+
+static int
+complete_rank_cmp(void const * const a, void const * const b)
+{
+	complete_rank_st const * const rank_a = a;
+	complete_rank_st const * const rank_b = b;
+
+	/* Best score first, then the shortest, then in the original order. */
+	if (rank_a->score != rank_b->score) {
+		return (rank_a->score < rank_b->score) ? 1 : -1;
+	}
+	if (rank_a->len != rank_b->len) {
+		return (rank_a->len < rank_b->len) ? -1 : 1;
+	}
+
+	return (rank_a->index < rank_b->index) ? -1 : 1;
+}
+
+/*
+ * Rank the matches by how well they fuzzy match the word being completed.
+ * The word is replaced if only one matches, otherwise the matches that do
+ * are displayed, best first.
+ */
+static bool
+complete_fuzzy(
+	minirl_st * const minirl,
+	unsigned const start,
+	complete_matches_st const * const matches)
+{
+	char const * const line = minirl_line_get(minirl);
+	size_t const point = minirl_point_get(minirl);
+	complete_rank_st * const ranks = malloc(sizeof(*ranks) * matches->count);
+	minirl_span_st *spans = NULL;
+	fuzzy_query_st query;
+	size_t count = 0;
+	bool res = false;
+
+	if (ranks == NULL) {
+		return false;
+	}
+
+	fuzzy_query_init(&query, line + start, point - start);
+	for (size_t i = 0; i < matches->count; i++) {
+		size_t len;
+		char const * const match = complete_match_get(matches, i, &len);
+		int const score = fuzzy_score(&query, match, len);
+
+		if (score >= 0) {
+			ranks[count++] = (complete_rank_st){
+				.index = i,
+				.len = len,
+				.score = score
+			};
+		}
+	}
+	if (count == 0) {
+		goto done;
+	}
+
+	qsort(ranks, count, sizeof(*ranks), complete_rank_cmp);
+
+	if (count == 1) {
+		size_t len;
+		char const * const match = complete_match_get(matches, ranks[0].index, &len);
+
+		minirl_text_delete(minirl, start, point);
+		res = minirl_text_len_insert(minirl, match, len);
+		goto done;
+	}
+
+	spans = malloc(sizeof(*spans) * count);
+	if (spans == NULL) {
+		goto done;
+	}
+	for (size_t i = 0; i < count; i++) {
+		spans[i].s = complete_match_get(matches, ranks[i].index, &spans[i].len);
+	}
+
+	complete_matches_st const ranked = { .spans = spans, .count = count };
+
+	if (!complete_display(minirl, &ranked)) {
+		minirl_line_state_reset(minirl);
+	}
+
+done:
+	free(spans);
+	free(ranks);
+
+	return res;
+}
+
+NO_EXPORT
+bool
+complete_common_prefix(
+	minirl_st * const minirl,
+	unsigned const start,
+	complete_matches_st const * const matches,
+	unsigned len,
+	bool const prefix,
+	bool const allow_prefix)
+{
+	bool did_some_completion;
+	bool res = false;
+	unsigned start_from = 0;
+	unsigned const end = minirl_point_get(minirl);
+
+	if (minirl->options.fuzzy && end > start) {
+		return complete_fuzzy(minirl, start, matches);
+	}
+
+	/*
+	 * The portion of the match from the start to the cursor position
+	 * matches so it's only necessary to insert from that position now.
+	 * Exclude the characters that already match.
+	 */
+	start_from = end - start;
+	len -= end - start;
+
+	/* Insert the rest of the common prefix */
+
+	if (len > 0) {
+		size_t first_len;
+		char const * const first = complete_match_get(matches, 0, &first_len);
+
+		if (!minirl_text_len_insert(minirl, &first[start_from], len)) {
+			return false;
+		}
+		did_some_completion = true;
+	} else {
+		did_some_completion = false;
+	}
+
+	/* Is there only one completion? */
+	if (matches->count == 1) {
+		res = true;
+		goto done;
+	}
+
+	/* Is the prefix valid? */
+	if (prefix && allow_prefix) {
+		res = true;
+		goto done;
+	}
+
+	/* Display matches if no progress was made */
+	if (!did_some_completion && !complete_display(minirl, matches)) {
+		/*
+		 * line state needs to be reset so that the cursor isn't moved
+		 * around during the terminal refresh.
+		 */
+		minirl_line_state_reset(minirl);
+	}
+
+done:
+	return res;
+}
+
+bool
+minirl_complete(
+	minirl_st * const minirl,
+	unsigned const start,
+	char ** const matches,
+	bool const allow_prefix)
+{
+	bool prefix;
+
+	if (matches == NULL || matches[0] == NULL) {
+		return false;
+	}
+
+	/* Identify a common prefix. */
+	unsigned len = strlen(matches[0]);
+	size_t i;
+
+	prefix = true;
+	for (i = 1; matches[i] != NULL; i++) {
+		unsigned common;
+
+		for (common = 0; common < len; common++) {
+			if (matches[0][common] != matches[i][common]) {
+				break;
+			}
+		}
+		if (len != common) {
+			len = common;
+			prefix = !matches[i][len];
+		}
+	}
+
+	complete_matches_st const all = { .strings = matches, .count = i };
+
+	return complete_common_prefix(minirl, start, &all, len, prefix, allow_prefix);
+}
+
+bool
+minirl_complete_spans(
+	minirl_st * const minirl,
+	unsigned const start,
+	minirl_span_st const * const matches,
+	size_t const count,
+	bool const allow_prefix)
+{
+	if (count == 0) {
+		return false;
+	}
+
+	/* Find the common prefix in one pass, without any strlen(). */
+	size_t len = matches[0].len;
+	bool prefix = true;
+
+	for (size_t i = 1; i < count; i++) {
+		size_t const match_len = matches[i].len;
+		size_t common = 0;
+		size_t const limit = (match_len < len) ? match_len : len;
+
+		while (common < limit && matches[0].s[common] == matches[i].s[common]) {
+			common++;
+		}
+		if (len != common) {
+			len = common;
+			prefix = match_len == len;
+		}
+	}
+
+	complete_matches_st const all = { .spans = matches, .count = count };
+
+	return complete_common_prefix(minirl, start, &all, len, prefix, allow_prefix);
+}
+
+static int
+complete_match_cmp(void const * const a, void const * const b)
+{
+	return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+NO_EXPORT
+void
+complete_cache_clear(complete_cache_st * const cache)
+{
+	if (cache->matches != NULL) {
+		for (size_t i = 0; i < cache->count; i++) {
+			free(cache->matches[i]);
+		}
+		free(cache->matches);
+	}
+	free(cache->line);
+	*cache = (complete_cache_st){ 0 };
+}
+
+/*
+ * Check whether the cached matches are for the word being completed, i.e.
+ * the line before the word is the same, and the word starts with the
+ * prefix that the matches were filtered by and still has no spaces in it.
+ */
+static bool
+complete_cache_is_valid(
+	complete_cache_st const * const cache,
+	void const * const token,
+	char const * const line,
+	size_t const point)
+{
+	size_t const prefix_end = cache->start + cache->prefix_len;
+
+	if (cache->matches == NULL
+	    || cache->token != token
+	    || point < prefix_end
+	    || memcmp(line, cache->line, prefix_end) != 0) {
+		return false;
+	}
+
+	return memchr(line + prefix_end, ' ', point - prefix_end) == NULL;
+}
+
+/*
+ * Narrow the cached matches to those starting with the word being
+ * completed. As they are sorted, these are all together, so move them to
+ * the start of the array.
+ */
+static bool
+complete_cache_narrow(
+	complete_cache_st * const cache,
+	char const * const line,
+	size_t const point)
+{
+	char const * const word = line + cache->start;
+	size_t const word_len = point - cache->start;
+
+	if (word_len == cache->prefix_len) {
+		return true;
+	}
+
+	size_t lo = 0;
+	size_t hi = cache->count;
+
+	/* Find the first match that isn't before the word. */
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+
+		if (strncmp(cache->matches[mid], word, word_len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	size_t end = lo;
+
+	while (end < cache->count && strncmp(cache->matches[end], word, word_len) == 0) {
+		end++;
+	}
+
+	for (size_t i = 0; i < cache->count; i++) {
+		if (i < lo || i >= end) {
+			free(cache->matches[i]);
+		}
+	}
+	memmove(cache->matches, cache->matches + lo, sizeof(char *) * (end - lo));
+	cache->count = end - lo;
+	cache->matches[cache->count] = NULL;
+
+	char * const new_line = realloc(cache->line, point + 1);
+
+	if (new_line == NULL) {
+		return false;
+	}
+	memcpy(new_line, line, point);
+	new_line[point] = '\0';
+	cache->line = new_line;
+	cache->prefix_len = word_len;
+
+	return true;
+}
+
+static bool
+complete_cache_fill(
+	complete_cache_st * const cache,
+	void const * const token,
+	char const * const line,
+	size_t const point,
+	minirl_completion_cb const cb,
+	void * const user_ctx)
+{
+	unsigned start = point;
+	char ** const matches = cb(line, point, &start, user_ctx);
+
+	complete_cache_clear(cache);
+	if (matches == NULL) {
+		return false;
+	}
+	cache->matches = matches;
+	while (matches[cache->count] != NULL) {
+		cache->count++;
+	}
+	if (start > point) {
+		return false;
+	}
+	cache->line = strndup(line, point);
+	if (cache->line == NULL) {
+		return false;
+	}
+	cache->token = token;
+	cache->start = start;
+	cache->prefix_len = point - start;
+	qsort(cache->matches, cache->count, sizeof(char *), complete_match_cmp);
+
+	return true;
+}
+
+bool
+minirl_complete_cached(
+	minirl_st * const minirl,
+	void const * const token,
+	minirl_completion_cb const cb,
+	bool const allow_prefix,
+	void * const user_ctx)
+{
+	complete_cache_st * const cache = &minirl->complete_cache;
+	char const * const line = minirl_line_get(minirl);
+	size_t const point = minirl_point_get(minirl);
+
+	if (complete_cache_is_valid(cache, token, line, point)) {
+		/*
+		 * Matches that don't start with the word may still fuzzy match
+		 * it, so they're all kept for fuzzy matching to rank.
+		 */
+		if (!minirl->options.fuzzy && !complete_cache_narrow(cache, line, point)) {
+			complete_cache_clear(cache);
+			return false;
+		}
+	} else if (!complete_cache_fill(cache, token, line, point, cb, user_ctx)) {
+		complete_cache_clear(cache);
+		return false;
+	}
+
+	if (cache->count == 0) {
+		return false;
+	}
+
+	/*
+	 * As the matches are sorted, the prefix common to them all is that of
+	 * the first and last, and if that prefix is itself a match, it's the
+	 * first.
+	 */
+	char const * const first = cache->matches[0];
+	char const * const last = cache->matches[cache->count - 1];
+	unsigned len = 0;
+
+	while (first[len] != '\0' && first[len] == last[len]) {
+		len++;
+	}
+
+	complete_matches_st const all = {
+		.strings = cache->matches,
+		.count = cache->count
+	};
+
+	return complete_common_prefix(minirl,
+				      cache->start,
+				      &all,
+				      len,
+				      first[len] == '\0',
+				      allow_prefix);
+}
+
+void
+minirl_complete_cache_clear(minirl_st * const minirl)
+{
+	complete_cache_clear(&minirl->complete_cache);
+}
+
+NO_EXPORT
+void
+complete_menu_clear(complete_menu_st * const menu)
+{
+	complete_matches_free(menu->matches);
+	free(menu->word);
+	buffer_clear(&menu->line);
+	*menu = (complete_menu_st){ 0 };
+}
+
+/* Check that the line is as the last replacement left it. */
+static bool
+complete_menu_is_active(complete_menu_st const * const menu, minirl_st * const minirl)
+{
+	size_t const len = minirl_end_get(minirl);
+
+	return menu->matches != NULL
+		&& minirl_point_get(minirl) == menu->end
+		&& menu->line.len == len
+		&& memcmp(menu->line.b, minirl_line_get(minirl), len) == 0;
+}
+
+/* Replace the text from 'start' to 'end' with the selected match. */
+static bool
+complete_menu_select(complete_menu_st * const menu, minirl_st * const minirl)
+{
+	char const * const text = (menu->index == menu->count)
+		? menu->word
+		: menu->matches[menu->index];
+	size_t const len = strlen(text);
+
+	if (!minirl_text_replace(minirl, menu->start, menu->end, text, len)) {
+		return false;
+	}
+	menu->end = menu->start + len;
+	menu->line.len = 0;
+
+	return buffer_append(&menu->line, minirl_line_get(minirl), minirl_end_get(minirl));
+}
+
+static bool
+complete_menu_fill(
+	complete_menu_st * const menu,
+	minirl_st * const minirl,
+	minirl_completion_cb const cb,
+	void * const user_ctx)
+{
+	char const * const line = minirl_line_get(minirl);
+	size_t const point = minirl_point_get(minirl);
+	unsigned start = point;
+	char ** const matches = cb(line, point, &start, user_ctx);
+
+	complete_menu_clear(menu);
+	if (matches == NULL) {
+		return false;
+	}
+	menu->matches = matches;
+	while (matches[menu->count] != NULL) {
+		menu->count++;
+	}
+	if (start > point || menu->count == 0) {
+		return false;
+	}
+	menu->word = strndup(line + start, point - start);
+	if (menu->word == NULL) {
+		return false;
+	}
+	menu->start = start;
+	menu->end = point;
+	buffer_init(&menu->line, minirl_end_get(minirl));
+
+	return true;
+}
+
+bool
+minirl_complete_menu(
+	minirl_st * const minirl,
+	minirl_completion_cb const cb,
+	bool const reverse,
+	void * const user_ctx)
+{
+	complete_menu_st * const menu = &minirl->complete_menu;
+
+	if (complete_menu_is_active(menu, minirl)) {
+		/* Move on to the next match, without asking for them again. */
+		size_t const num_choices = menu->count + 1;
+
+		menu->index = (menu->index + (reverse ? num_choices - 1 : 1)) % num_choices;
+	} else {
+		if (!complete_menu_fill(menu, minirl, cb, user_ctx)) {
+			complete_menu_clear(menu);
+			return false;
+		}
+		menu->index = reverse ? menu->count - 1 : 0;
+	}
+
+	if (!complete_menu_select(menu, minirl)) {
+		complete_menu_clear(menu);
+		return false;
+	}
+	if (menu->count == 1) {
+		/* Nothing to cycle through. */
+		complete_menu_clear(menu);
+	}
+
+	return true;
+}
+
+bool
+minirl_complete_async(
+	minirl_st * const minirl,
+	minirl_completion_cb const cb,
+	bool const allow_prefix,
+	void * const user_ctx)
+{
+	if (minirl->async == NULL) {
+		minirl->async = complete_async_new();
+		if (minirl->async == NULL) {
+			return false;
+		}
+	}
+
+	minirl_state_st const * const l = &minirl->state;
+	complete_request_st * const request = calloc(1, sizeof(*request));
+
+	if (request == NULL) {
+		return false;
+	}
+	request->line = strndup(l->line_buf->b, l->len);
+	if (request->line == NULL) {
+		free(request);
+		return false;
+	}
+	request->async = minirl->async;
+	request->len = l->len;
+	request->point = l->pos;
+	request->cb = cb;
+	request->user_ctx = user_ctx;
+	request->allow_prefix = allow_prefix;
+	request->serial = atomic_fetch_add(&minirl->async->serial, 1) + 1;
+
+	if (!worker_pool_submit(minirl->async->pool, complete_async_job, request)) {
+		complete_request_free(request);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "minirl.h"
+#include "buffer.h"
+#include "key_binding.h"
+#include "worker.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef struct complete_request_st complete_request_st;
+
+/*
+ * Completions are produced on worker threads, which queue the results on
+ * 'done' and signal 'event_fd', which the editing loop waits on along with
+ * the input.
+ * Every request is given a new serial number, and only the results of the
+ * latest request are used.
+ */
+typedef struct complete_async_st {
+	worker_pool_st *pool;
+	int event_fd;
+	pthread_mutex_t lock;
+	complete_request_st *done;
+	atomic_ulong serial;
+} complete_async_st;
+
+/*
+ * The matches last got from the callback passed to minirl_complete_cached(),
+ * sorted, and narrowed down to those starting with the word being completed
+ * as it's extended, unless fuzzy matching is enabled.
+ * 'line' is the line up to the end of the word when the matches were last
+ * narrowed, and 'prefix_len' is the length of the word then.
+ */
+typedef struct complete_cache_st {
+	void const *token;
+	char *line;
+	unsigned start;
+	size_t prefix_len;
+	char **matches;
+	size_t count;
+} complete_cache_st;
+
+void
+complete_cache_clear(complete_cache_st *cache);
+
+/*
+ * The matches that minirl_complete_menu() cycles through, replacing the
+ * text from 'start' to 'end' with each in turn, followed by the word as
+ * typed. 'line' is the line as it was left by the last replacement, so that
+ * any other edit in the meantime starts a new completion.
+ */
+typedef struct complete_menu_st {
+	char **matches;
+	size_t count;
+	size_t index;           /* 'count' selects the word as typed. */
+	size_t start;
+	size_t end;
+	char *word;
+	struct buffer line;
+} complete_menu_st;
+
+void
+complete_menu_clear(complete_menu_st *menu);
+
+/* A set of matches, given either as NUL terminated strings or as spans. */
+typedef struct complete_matches_st {
+	char * const *strings;
+	minirl_span_st const *spans;
+	size_t count;
+} complete_matches_st;
+
+/* How matches are laid out in columns for display. */
+typedef struct complete_layout_st {
+	size_t num_cols;
+	size_t num_rows;
+	size_t *col_widths;
+} complete_layout_st;
+
+static inline char const *
+complete_match_get(
+	complete_matches_st const * const matches,
+	size_t const i,
+	size_t * const len)
+{
+	if (matches->spans != NULL) {
+		*len = matches->spans[i].len;
+		return matches->spans[i].s;
+	}
+	*len = strlen(matches->strings[i]);
+
+	return matches->strings[i];
+}
+
+/*
+ * Insert the first 'len' bytes of the first match, which all the matches
+ * have in common, in place of the text from 'start' to the cursor.
+ * 'prefix' indicates that those bytes are also a match.
+ * The matches are displayed if the line couldn't be completed any further.
+ */
+bool
+complete_common_prefix(
+	minirl_st *minirl,
+	unsigned start,
+	complete_matches_st const *matches,
+	unsigned len,
+	bool prefix,
+	bool allow_prefix);
+
+typedef enum complete_pager_state {
+	COMPLETE_PAGER_IDLE,
+	COMPLETE_PAGER_QUERY,   /* Asking whether to display the matches. */
+	COMPLETE_PAGER_MORE     /* Waiting to display the next page. */
+} complete_pager_state;
+
+/*
+ * State of a display of matches too long to show all at once. While active
+ * its keymap is in use, so that keys control the display.
+ * The caller may free the matches as soon as it has passed them, so they
+ * are copied into 'text', and 'matches' refers to them there.
+ */
+typedef struct complete_pager_st {
+	complete_pager_state state;
+	size_t query_items;
+	struct buffer text;
+	complete_matches_st matches;
+	size_t *widths;
+	complete_layout_st layout;
+	size_t next_row;
+	minirl_keymap_st *keymap;
+	minirl_keymap_st *saved_keymap;
+} complete_pager_st;
+
+bool
+complete_pager_init(minirl_st *minirl);
+
+void
+complete_pager_free(minirl_st *minirl);
+
+/* End the display of matches if it's still in progress. */
+void
+complete_pager_end(minirl_st *minirl);
+
+complete_async_st *
+complete_async_new(void);
+
+void
+complete_async_free(complete_async_st *async);
+
+/* Get the fd to wait on for completions, or -1 if none have been requested. */
+int
+complete_async_fd(minirl_st const *minirl);
+
+/* Drop the results of any requests that are still outstanding. */
+void
+complete_async_cancel(minirl_st *minirl);
+
+/*
+ * Complete the line using the results of the latest request, so long as
+ * the line hasn't changed since the request was made.
+ */
+void
+complete_async_apply(minirl_st *minirl);
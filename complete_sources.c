@@ -0,0 +1,327 @@
+#include "minirl.h"
+#include "complete_sources.h"
+#include "export.h"
+#include "private.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPLETE_SOURCES_MAX_THREADS 4
+
+/* Waits for the sources run on the pool to finish. */
+typedef struct complete_fanout_st {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	size_t pending;
+} complete_fanout_st;
+
+/* A run of a single source, and its matches, which are sorted. */
+typedef struct complete_run_st {
+	complete_source_st const *source;
+	complete_fanout_st *fanout;
+	char const *line;
+	size_t point;
+
+	unsigned start;
+	char **matches;
+	size_t count;
+	size_t next;            /* The next match to merge. */
+} complete_run_st;
+
+static int
+complete_match_cmp(void const * const a, void const * const b)
+{
+	return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+static void
+complete_run(complete_run_st * const run)
+{
+	run->start = run->point;
+	run->matches = run->source->cb(run->line, run->point, &run->start, run->source->user_ctx);
+	if (run->matches == NULL) {
+		return;
+	}
+	while (run->matches[run->count] != NULL) {
+		run->count++;
+	}
+	qsort(run->matches, run->count, sizeof(char *), complete_match_cmp);
+}
+
+static void
+complete_run_job(void * const arg)
+{
+	complete_run_st * const run = arg;
+	complete_fanout_st * const fanout = run->fanout;
+
+	complete_run(run);
+
+	pthread_mutex_lock(&fanout->lock);
+	fanout->pending--;
+	if (fanout->pending == 0) {
+		pthread_cond_signal(&fanout->cond);
+	}
+	pthread_mutex_unlock(&fanout->lock);
+}
+
+static void
+complete_run_free(complete_run_st * const run)
+{
+	if (run->matches == NULL) {
+		return;
+	}
+	/* Free those not taken by the merge. */
+	for (size_t i = run->next; i < run->count; i++) {
+		free(run->matches[i]);
+	}
+	free(run->matches);
+}
+
+static char const *
+complete_run_head(complete_run_st const * const run)
+{
+	return run->matches[run->next];
+}
+
+/*
+ * Restore the order of the heap of runs, by the next match of each, below
+ * 'i'.
+ */
+static void
+complete_heap_down(complete_run_st ** const heap, size_t const count, size_t i)
+{
+	for (;;) {
+		size_t smallest = i;
+		size_t const left = 2 * i + 1;
+		size_t const right = left + 1;
+
+		if (left < count
+		    && strcmp(complete_run_head(heap[left]), complete_run_head(heap[smallest])) < 0) {
+			smallest = left;
+		}
+		if (right < count
+		    && strcmp(complete_run_head(heap[right]), complete_run_head(heap[smallest])) < 0) {
+			smallest = right;
+		}
+		if (smallest == i) {
+			break;
+		}
+
+		complete_run_st * const tmp = heap[i];
+
+		heap[i] = heap[smallest];
+		heap[smallest] = tmp;
+		i = smallest;
+	}
+}
+
+/*
+ * Merge the sorted matches of the runs into a single sorted, NULL
+ * terminated array, dropping duplicates. The matches are moved into the
+ * array, so the runs only keep those that weren't taken.
+ */
+static char **
+complete_merge(complete_run_st * const runs, size_t const num_runs, size_t const total)
+{
+	char ** const merged = malloc(sizeof(*merged) * (total + 1));
+	complete_run_st ** const heap = malloc(sizeof(*heap) * num_runs);
+	size_t count = 0;
+	size_t heap_count = 0;
+
+	if (merged == NULL || heap == NULL) {
+		free(merged);
+		free(heap);
+		return NULL;
+	}
+
+	for (size_t i = 0; i < num_runs; i++) {
+		if (runs[i].count > 0) {
+			heap[heap_count++] = &runs[i];
+		}
+	}
+	for (size_t i = heap_count; i-- > 0;) {
+		complete_heap_down(heap, heap_count, i);
+	}
+
+	while (heap_count > 0) {
+		complete_run_st * const run = heap[0];
+		char * const match = run->matches[run->next++];
+
+		if (count > 0 && strcmp(merged[count - 1], match) == 0) {
+			free(match);
+		} else {
+			merged[count++] = match;
+		}
+
+		if (run->next == run->count) {
+			heap[0] = heap[--heap_count];
+		}
+		complete_heap_down(heap, heap_count, 0);
+	}
+	merged[count] = NULL;
+	free(heap);
+
+	return merged;
+}
+
+NO_EXPORT
+void
+complete_sources_free(complete_sources_st * const sources)
+{
+	if (sources == NULL) {
+		return;
+	}
+	worker_pool_free(sources->pool);
+	free(sources->sources);
+	free(sources);
+}
+
+bool
+minirl_complete_source_add(
+	minirl_st * const minirl,
+	minirl_completion_cb const cb,
+	void * const user_ctx)
+{
+	if (minirl->sources == NULL) {
+		minirl->sources = calloc(1, sizeof(*minirl->sources));
+		if (minirl->sources == NULL) {
+			return false;
+		}
+	}
+
+	complete_sources_st * const sources = minirl->sources;
+	complete_source_st * const new_sources =
+		realloc(sources->sources, sizeof(*new_sources) * (sources->count + 1));
+
+	if (new_sources == NULL) {
+		return false;
+	}
+	new_sources[sources->count] = (complete_source_st){
+		.cb = cb,
+		.user_ctx = user_ctx
+	};
+	sources->sources = new_sources;
+	sources->count++;
+
+	return true;
+}
+
+bool
+minirl_complete_sources(minirl_st * const minirl, bool const allow_prefix)
+{
+	complete_sources_st * const sources = minirl->sources;
+
+	if (sources == NULL) {
+		return false;
+	}
+
+	size_t const num_runs = sources->count;
+
+	if (num_runs > 1 && sources->pool == NULL) {
+		size_t const num_threads = (num_runs - 1 < COMPLETE_SOURCES_MAX_THREADS)
+			? num_runs - 1
+			: COMPLETE_SOURCES_MAX_THREADS;
+
+		sources->pool = worker_pool_new(num_threads);
+	}
+
+	complete_run_st * const runs = calloc(num_runs, sizeof(*runs));
+	complete_fanout_st fanout = { .pending = 0 };
+	bool res = false;
+
+	if (runs == NULL) {
+		return false;
+	}
+	if (pthread_mutex_init(&fanout.lock, NULL) != 0) {
+		free(runs);
+		return false;
+	}
+	if (pthread_cond_init(&fanout.cond, NULL) != 0) {
+		pthread_mutex_destroy(&fanout.lock);
+		free(runs);
+		return false;
+	}
+
+	/*
+	 * The line can't change until this returns, so the sources can all
+	 * read it as it is. Run the first source here rather than leaving this
+	 * thread idle, and any the pool can't take too.
+	 */
+	for (size_t i = 0; i < num_runs; i++) {
+		runs[i] = (complete_run_st){
+			.source = &sources->sources[i],
+			.fanout = &fanout,
+			.line = minirl_line_get(minirl),
+			.point = minirl_point_get(minirl)
+		};
+	}
+	for (size_t i = 1; i < num_runs; i++) {
+		pthread_mutex_lock(&fanout.lock);
+		fanout.pending++;
+		pthread_mutex_unlock(&fanout.lock);
+
+		if (sources->pool == NULL
+		    || !worker_pool_submit(sources->pool, complete_run_job, &runs[i])) {
+			complete_run_job(&runs[i]);
+		}
+	}
+	if (num_runs > 0) {
+		complete_run(&runs[0]);
+	}
+
+	pthread_mutex_lock(&fanout.lock);
+	while (fanout.pending > 0) {
+		pthread_cond_wait(&fanout.cond, &fanout.lock);
+	}
+	pthread_mutex_unlock(&fanout.lock);
+
+	/*
+	 * The matches all replace the same text, so the earliest source with
+	 * any matches decides where that starts, and sources that disagree are
+	 * left out.
+	 */
+	size_t total = 0;
+	unsigned start = 0;
+	bool have_start = false;
+
+	for (size_t i = 0; i < num_runs; i++) {
+		complete_run_st * const run = &runs[i];
+
+		if (run->count == 0) {
+			continue;
+		}
+		if (!have_start) {
+			start = run->start;
+			have_start = run->start <= run->point;
+		}
+		if (!have_start || run->start != start) {
+			complete_run_free(run);
+			run->matches = NULL;
+			run->count = 0;
+			continue;
+		}
+		total += run->count;
+	}
+
+	if (total > 0) {
+		char ** const merged = complete_merge(runs, num_runs, total);
+
+		if (merged != NULL) {
+			res = minirl_complete(minirl, start, merged, allow_prefix);
+			for (char **m = merged; *m != NULL; m++) {
+				free(*m);
+			}
+			free(merged);
+		}
+	}
+
+	for (size_t i = 0; i < num_runs; i++) {
+		complete_run_free(&runs[i]);
+	}
+	free(runs);
+	pthread_cond_destroy(&fanout.cond);
+	pthread_mutex_destroy(&fanout.lock);
+
+	return res;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "minirl.h"
+#include "worker.h"
+
+#include <stddef.h>
+
+typedef struct complete_source_st {
+	minirl_completion_cb cb;
+	void *user_ctx;
+} complete_source_st;
+
+/*
+ * The sources of matches that minirl_complete_sources() combines. All but
+ * the first are run on the pool, which is created when first needed.
+ */
+typedef struct complete_sources_st {
+	complete_source_st *sources;
+	size_t count;
+	worker_pool_st *pool;
+} complete_sources_st;
+
+void
+complete_sources_free(complete_sources_st *sources);
@@ -0,0 +1,330 @@
+#include "minirl.h"
+#include "fuzzy.h"
+#include "export.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * The scoring follows fzf: every matched byte scores, and there are bonuses
+ * for matches at the start of words, and for consecutive matches, while
+ * gaps between matches cost a little.
+ */
+#define FUZZY_SCORE_MATCH 16
+#define FUZZY_SCORE_GAP_START 3
+#define FUZZY_SCORE_GAP_EXTENSION 1
+#define FUZZY_BONUS_BOUNDARY 8
+#define FUZZY_BONUS_CAMEL 7
+#define FUZZY_BONUS_CONSECUTIVE (FUZZY_SCORE_GAP_START + FUZZY_SCORE_GAP_EXTENSION)
+#define FUZZY_BONUS_FIRST_MULTIPLIER 2
+
+NO_EXPORT
+void
+fuzzy_query_init(fuzzy_query_st * const query, char const * const s, size_t const len)
+{
+	bool ignore_case = true;
+
+	query->len = (len < FUZZY_MAX_QUERY) ? len : FUZZY_MAX_QUERY;
+	for (size_t i = 0; i < query->len; i++) {
+		if (isupper((unsigned char)s[i])) {
+			ignore_case = false;
+		}
+	}
+	for (size_t i = 0; i < query->len; i++) {
+		unsigned char const c = s[i];
+
+		query->lower[i] = ignore_case ? tolower(c) : c;
+		query->upper[i] = ignore_case ? toupper(c) : c;
+	}
+}
+
+/*
+ * Get a mask of the bytes of 's' from 'base' that equal 'a' or 'b', with bit
+ * 0 for the byte at 'base', for up to 16 bytes before 'len'.
+ */
+static unsigned
+fuzzy_chunk_mask(
+	char const * const s,
+	size_t const base,
+	size_t const len,
+	char const a,
+	char const b)
+{
+#ifdef __SSE2__
+	__m128i chunk;
+	unsigned shift = 0;
+	unsigned valid = 0xffff;
+
+	if (len - base >= 16) {
+		chunk = _mm_loadu_si128((__m128i const *)(s + base));
+	} else if (len >= 16) {
+		/*
+		 * Rather than reading past the end, load the last 16 bytes and
+		 * shift away those before 'base'.
+		 */
+		shift = base - (len - 16);
+		chunk = _mm_loadu_si128((__m128i const *)(s + len - 16));
+	} else {
+		char tail[16] = { 0 };
+
+		memcpy(tail, s + base, len - base);
+		chunk = _mm_loadu_si128((__m128i const *)tail);
+		valid = (1u << (len - base)) - 1;
+	}
+
+	unsigned const mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(a)),
+							     _mm_cmpeq_epi8(chunk, _mm_set1_epi8(b))));
+
+	return (mask >> shift) & valid;
+#else
+	size_t const n = (len - base < 16) ? len - base : 16;
+	unsigned mask = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		if (s[base + i] == a || s[base + i] == b) {
+			mask |= 1u << i;
+		}
+	}
+
+	return mask;
+#endif
+}
+
+/*
+ * Check that the query is a subsequence of the candidate, finding the
+ * earliest position that each query byte can match at. Most candidates fail
+ * this check, so it is done before any scoring, a chunk of the candidate at
+ * a time.
+ */
+static bool
+fuzzy_prefilter(
+	fuzzy_query_st const * const query,
+	char const * const candidate,
+	size_t const len,
+	size_t * const starts)
+{
+	size_t i = 0;
+	size_t pos = 0;
+
+	for (size_t base = 0; base < len; base += 16) {
+		for (;;) {
+			unsigned const skip = (pos > base) ? (1u << (pos - base)) - 1 : 0;
+			unsigned const mask = fuzzy_chunk_mask(candidate, base, len,
+							       query->lower[i], query->upper[i])
+				& ~skip;
+
+			if (mask == 0) {
+				break;
+			}
+			starts[i] = base + __builtin_ctz(mask);
+			pos = starts[i] + 1;
+			i++;
+			if (i == query->len) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+typedef enum fuzzy_class {
+	FUZZY_CLASS_OTHER,
+	FUZZY_CLASS_LOWER,
+	FUZZY_CLASS_UPPER,
+	FUZZY_CLASS_DIGIT,
+	FUZZY_NUM_CLASSES
+} fuzzy_class;
+
+static uint8_t const fuzzy_char_class[256] = {
+	['a' ... 'z'] = FUZZY_CLASS_LOWER,
+	['A' ... 'Z'] = FUZZY_CLASS_UPPER,
+	['0' ... '9'] = FUZZY_CLASS_DIGIT,
+};
+
+/* The bonus for a match, by the class of the previous byte and its own. */
+static int8_t const fuzzy_bonus_table[FUZZY_NUM_CLASSES][FUZZY_NUM_CLASSES] = {
+	[FUZZY_CLASS_OTHER] = {
+		[FUZZY_CLASS_LOWER] = FUZZY_BONUS_BOUNDARY,
+		[FUZZY_CLASS_UPPER] = FUZZY_BONUS_BOUNDARY,
+		[FUZZY_CLASS_DIGIT] = FUZZY_BONUS_BOUNDARY,
+	},
+	[FUZZY_CLASS_LOWER] = {
+		[FUZZY_CLASS_UPPER] = FUZZY_BONUS_CAMEL,
+		[FUZZY_CLASS_DIGIT] = FUZZY_BONUS_CAMEL,
+	},
+	[FUZZY_CLASS_UPPER] = {
+		[FUZZY_CLASS_DIGIT] = FUZZY_BONUS_CAMEL,
+	},
+};
+
+static int
+fuzzy_bonus(char const * const s, size_t const pos)
+{
+	uint8_t const prev = (pos == 0) ? FUZZY_CLASS_OTHER : fuzzy_char_class[(unsigned char)s[pos - 1]];
+
+	return fuzzy_bonus_table[prev][fuzzy_char_class[(unsigned char)s[pos]]];
+}
+
+/*
+ * The positions, relative to the first match of the query, at which a query
+ * byte can match, with the best score for the query up to that byte matching
+ * there.
+ */
+typedef struct fuzzy_row_st {
+	size_t count;
+	uint16_t pos[FUZZY_MAX_CANDIDATE];
+	int16_t score[FUZZY_MAX_CANDIDATE];
+} fuzzy_row_st;
+
+/*
+ * Only the positions at which each query byte matches are scored, rather
+ * than every byte of the candidate. A match directly follows the match of
+ * the previous query byte, or follows a gap. The best score with a gap is
+ * the best over the earlier matches of the previous byte of
+ * 'score + pos * FUZZY_SCORE_GAP_EXTENSION', less the cost of a gap up to
+ * this position, so a running maximum of that is kept.
+ * Only the part of the candidate from where the first query byte first
+ * matches to where the last one last matches is scored, and each query byte
+ * can't match before the position found for it by the prefilter.
+ */
+NO_EXPORT
+int
+fuzzy_score(fuzzy_query_st const * const query, char const * const candidate, size_t const len)
+{
+	size_t starts[FUZZY_MAX_QUERY];
+
+	if (query->len == 0) {
+		return 0;
+	}
+	if (!fuzzy_prefilter(query, candidate, len, starts)) {
+		return -1;
+	}
+
+	size_t const last_query = query->len - 1;
+	size_t end = len;
+
+	while (candidate[end - 1] != query->lower[last_query]
+	       && candidate[end - 1] != query->upper[last_query]) {
+		end--;
+	}
+
+	size_t const first = starts[0];
+
+	if (end - first > FUZZY_MAX_CANDIDATE) {
+		/* It does match, but is too long to be scored. */
+		return 0;
+	}
+
+	fuzzy_row_st rows[2];
+	fuzzy_row_st *prev = &rows[0];
+	fuzzy_row_st *row = &rows[1];
+
+	prev->count = 0;
+	for (size_t base = first; base < end; base += 16) {
+		unsigned mask = fuzzy_chunk_mask(candidate, base, end,
+						 query->lower[0], query->upper[0]);
+
+		for (; mask != 0; mask &= mask - 1) {
+			size_t const j = base + __builtin_ctz(mask);
+
+			prev->pos[prev->count] = j - first;
+			prev->score[prev->count] = FUZZY_SCORE_MATCH
+				+ fuzzy_bonus(candidate, j) * FUZZY_BONUS_FIRST_MULTIPLIER;
+			prev->count++;
+		}
+	}
+
+	for (size_t i = 1; i < query->len; i++) {
+		size_t k = 0;
+		int gapped = INT_MIN;
+
+		row->count = 0;
+		for (size_t base = starts[i]; base < end; base += 16) {
+			unsigned mask = fuzzy_chunk_mask(candidate, base, end,
+							 query->lower[i], query->upper[i]);
+
+			for (; mask != 0; mask &= mask - 1) {
+				size_t const j = base + __builtin_ctz(mask);
+				size_t const pos = j - first;
+				int best = INT_MIN;
+
+				while (k < prev->count && prev->pos[k] + 1u < pos) {
+					int const score = prev->score[k]
+						+ prev->pos[k] * FUZZY_SCORE_GAP_EXTENSION;
+
+					if (score > gapped) {
+						gapped = score;
+					}
+					k++;
+				}
+				if (gapped != INT_MIN) {
+					best = gapped - FUZZY_SCORE_GAP_START
+						- (int)(pos - 2) * FUZZY_SCORE_GAP_EXTENSION;
+				}
+				if (k < prev->count && prev->pos[k] + 1u == pos
+				    && prev->score[k] + FUZZY_BONUS_CONSECUTIVE > best) {
+					best = prev->score[k] + FUZZY_BONUS_CONSECUTIVE;
+				}
+				if (best == INT_MIN) {
+					continue;
+				}
+				row->pos[row->count] = pos;
+				row->score[row->count] = best + FUZZY_SCORE_MATCH + fuzzy_bonus(candidate, j);
+				row->count++;
+			}
+		}
+
+		fuzzy_row_st * const tmp = prev;
+
+		prev = row;
+		row = tmp;
+	}
+
+	int best = 0;
+
+	for (size_t k = 0; k < prev->count; k++) {
+		if (prev->score[k] > best) {
+			best = prev->score[k];
+		}
+	}
+
+	return best;
+}
+
+int
+minirl_fuzzy_score(char const * const query, char const * const candidate, size_t const len)
+{
+	fuzzy_query_st prepared;
+
+	fuzzy_query_init(&prepared, query, strlen(query));
+
+	return fuzzy_score(&prepared, candidate, len);
+}
+
+size_t
+minirl_fuzzy_scores(
+	char const * const query,
+	minirl_span_st const * const candidates,
+	size_t const count,
+	int * const scores)
+{
+	fuzzy_query_st prepared;
+	size_t matches = 0;
+
+	fuzzy_query_init(&prepared, query, strlen(query));
+	for (size_t i = 0; i < count; i++) {
+		scores[i] = fuzzy_score(&prepared, candidates[i].s, candidates[i].len);
+		if (scores[i] >= 0) {
+			matches++;
+		}
+	}
+
+	return matches;
+}
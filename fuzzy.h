@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Queries are only matched on up to this many bytes. */
+#define FUZZY_MAX_QUERY 64
+/* Candidates are only scored on up to this many bytes from the first match. */
+#define FUZZY_MAX_CANDIDATE 512
+
+/*
+ * A query prepared for matching against many candidates. Matching ignores
+ * case unless the query contains upper case letters, so each byte of the
+ * query is kept in both cases.
+ */
+typedef struct fuzzy_query_st {
+	size_t len;
+	char lower[FUZZY_MAX_QUERY];
+	char upper[FUZZY_MAX_QUERY];
+} fuzzy_query_st;
+
+void
+fuzzy_query_init(fuzzy_query_st *query, char const *s, size_t len);
+
+/*
+ * Score how well 'candidate' matches the query, with higher scores for
+ * matches that are consecutive or at the start of words.
+ * Returns -1 if the query isn't a subsequence of the candidate.
+ */
+int
+fuzzy_score(fuzzy_query_st const *query, char const *candidate, size_t len);
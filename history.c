@@ -0,0 +1,1142 @@
+#include "minirl.h"
+#include "history.h"
+#include "export.h"
+#include "fuzzy.h"
+#include "io.h"
+#include "private.h"
+
+#include <errno.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HISTORY_INDEX_MIN_SLOTS 8
+/* Don't bother compacting the arena until this much of it is dead. */
+#define HISTORY_ARENA_MIN_DEAD_BYTES 4096
+
+/*
+ * The number of lines added after a line was last used at which the weight
+ * given to how often it has been used is halved.
+ */
+#define HISTORY_FRECENCY_HALF_LIFE 32.0
+
+/* Load a field that a writer may be changing concurrently. */
+#define HISTORY_READ(field) __atomic_load_n(&(field), __ATOMIC_RELAXED)
+
+/*
+ * Get the ring shared with other processes, if any. It's set once by a
+ * writer, so has to be loaded with acquire ordering for the ring it points
+ * to to be seen as the writer set it up.
+ */
+static history_shm_st *
+history_shm_get(minirl_history_st * const history)
+{
+	return __atomic_load_n(&history->shm, __ATOMIC_ACQUIRE);
+}
+
+static void
+history_wait_for_readers(minirl_history_st * const history)
+{
+	while (atomic_load(&history->readers) != 0) {
+		sched_yield();
+	}
+}
+
+/*
+ * Free memory that may still be in use by readers, once they are done.
+ * Only called by a writer.
+ */
+static void
+history_retire(minirl_history_st * const history, void * const ptr)
+{
+	history_retired_st * const retired = malloc(sizeof(*retired));
+
+	if (retired == NULL) {
+		/* Fall back to waiting for the readers before freeing. */
+		history_wait_for_readers(history);
+		free(ptr);
+		return;
+	}
+	retired->ptr = ptr;
+	retired->next = history->retired;
+	history->retired = retired;
+}
+
+static void
+history_reclaim(minirl_history_st * const history)
+{
+	while (history->retired != NULL) {
+		history_retired_st * const retired = history->retired;
+
+		history->retired = retired->next;
+		free(retired->ptr);
+		free(retired);
+	}
+}
+
+static void
+history_write_begin(minirl_history_st * const history)
+{
+	pthread_mutex_lock(&history->lock);
+	atomic_fetch_add(&history->seq, 1);
+}
+
+static void
+history_write_end(minirl_history_st * const history)
+{
+	atomic_fetch_add(&history->seq, 1);
+	/*
+	 * Any reader that arrives after this point will only see the current
+	 * memory, so the retired memory can be freed if there are no readers
+	 * now. Otherwise it'll be freed by a later writer.
+	 */
+	if (history->retired != NULL && atomic_load(&history->readers) == 0) {
+		history_reclaim(history);
+	}
+	pthread_mutex_unlock(&history->lock);
+}
+
+static uint32_t
+history_hash(char const * const line)
+{
+	/* 32-bit FNV-1a. */
+	uint32_t hash = 2166136261u;
+
+	for (char const *p = line; *p != '\0'; p++) {
+		hash ^= (uint8_t)*p;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+ * Get the line of the entry at position 'index' of the entries array.
+ * The line is only valid until the history is next modified.
+ */
+static char const *
+history_line(minirl_history_st const * const history, size_t const index)
+{
+	return history->arena.b + history->entries[index].offset;
+}
+
+/*
+ * Find the entry with the given id within entries [lo, hi).
+ * Returns 'hi' if there is no such entry.
+ */
+static size_t
+history_entry_find_id(
+	minirl_history_st const * const history,
+	size_t const lo,
+	size_t const hi,
+	uint64_t const id)
+{
+	size_t first = lo;
+	size_t last = hi;
+
+	while (first < last) {
+		size_t const mid = first + (last - first) / 2;
+
+		if (history->entries[mid].id < id) {
+			first = mid + 1;
+		} else {
+			last = mid;
+		}
+	}
+
+	if (first < hi && history->entries[first].id == id) {
+		return first;
+	}
+
+	return hi;
+}
+
+static history_slot_st *
+history_index_alloc(size_t const max_len, size_t * const mask)
+{
+	/* Keep the load factor at or below one half. */
+	size_t num_slots = HISTORY_INDEX_MIN_SLOTS;
+
+	while (num_slots < max_len * 2) {
+		num_slots *= 2;
+	}
+	*mask = num_slots - 1;
+
+	return calloc(num_slots, sizeof(history_slot_st));
+}
+
+static void
+history_index_insert(
+	minirl_history_st * const history,
+	uint32_t const hash,
+	uint64_t const id,
+	uint32_t const count,
+	size_t const pos)
+{
+	size_t i = hash & history->index.mask;
+
+	while (history->index.slots[i].id != 0) {
+		i = (i + 1) & history->index.mask;
+	}
+	history->index.slots[i].id = id;
+	history->index.slots[i].hash = hash;
+	history->index.slots[i].count = count;
+	history->index.slots[i].pos = pos;
+}
+
+static void
+history_index_remove(
+	minirl_history_st * const history,
+	uint32_t const hash,
+	uint64_t const id)
+{
+	history_slot_st * const slots = history->index.slots;
+	size_t const mask = history->index.mask;
+	size_t i = hash & mask;
+
+	while (slots[i].id != id) {
+		if (slots[i].id == 0) {
+			/* Not indexed. */
+			return;
+		}
+		i = (i + 1) & mask;
+	}
+
+	/*
+	 * Backward shift deletion: pull following entries of the probe
+	 * sequence into the hole unless doing so would place them before
+	 * their home slot.
+	 */
+	for (size_t j = (i + 1) & mask; slots[j].id != 0; j = (j + 1) & mask) {
+		size_t const home = slots[j].hash & mask;
+		bool const can_move = (i <= j)
+			? (home <= i || home > j)
+			: (home <= i && home > j);
+
+		if (can_move) {
+			slots[i] = slots[j];
+			i = j;
+		}
+	}
+	slots[i].id = 0;
+}
+
+/*
+ * Find the slot for 'line', or NULL if it isn't in the history.
+ * Slots hold the position of their entry, so this is a plain hash lookup.
+ */
+static history_slot_st *
+history_index_find(
+	minirl_history_st const * const history,
+	char const * const line,
+	uint32_t const hash)
+{
+	history_slot_st * const slots = history->index.slots;
+	size_t const mask = history->index.mask;
+
+	for (size_t i = hash & mask; slots[i].id != 0; i = (i + 1) & mask) {
+		if (slots[i].hash == hash
+		    && strcmp(history_line(history, slots[i].pos), line) == 0) {
+			return &slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the slot of the entry with the given id, or NULL if it isn't indexed. */
+static history_slot_st *
+history_index_get(
+	minirl_history_st const * const history,
+	uint32_t const hash,
+	uint64_t const id)
+{
+	history_slot_st * const slots = history->index.slots;
+	size_t const mask = history->index.mask;
+
+	for (size_t i = hash & mask; slots[i].id != 0; i = (i + 1) & mask) {
+		if (slots[i].id == id) {
+			return &slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Copy the live entries into a new arena, in history order, leaving behind
+ * the dead bytes of removed and replaced entries.
+ * The arena is never resized in place as readers may be using it.
+ */
+static bool
+history_arena_compact(minirl_history_st * const history, size_t const extra)
+{
+	struct buffer arena;
+	size_t const live_bytes = history->arena.len - history->dead_bytes;
+
+	if (!buffer_init(&arena, live_bytes + extra)) {
+		return false;
+	}
+	for (size_t i = history->oldest; i < history->entries_len; i++) {
+		history_entry_st * const entry = &history->entries[i];
+		size_t const offset = arena.len;
+
+		if (entry->removed) {
+			continue;
+		}
+
+		buffer_append(&arena, history->arena.b + entry->offset, entry->len + 1);
+		entry->offset = offset;
+	}
+	history_retire(history, history->arena.b);
+	history->arena = arena;
+	history->dead_bytes = 0;
+
+	return true;
+}
+
+/*
+ * Append 'line' to the arena.
+ * Compaction is done here, as part of adding lines, once more than half of
+ * the arena is dead, so its cost is spread across the lines that were added.
+ */
+static bool
+history_arena_store(
+	minirl_history_st * const history,
+	char const * const line,
+	size_t const len,
+	size_t * const offset)
+{
+	size_t const required = len + 1;
+	struct buffer * const arena = &history->arena;
+	size_t const live_bytes = arena->len - history->dead_bytes;
+
+	if (history->dead_bytes >= HISTORY_ARENA_MIN_DEAD_BYTES
+	    && history->dead_bytes > live_bytes) {
+		if (!history_arena_compact(history, required)) {
+			return false;
+		}
+	}
+	if (arena->b == NULL || arena->capacity - arena->len < required) {
+		/*
+		 * Grow by compacting into a bigger arena, doubling the live
+		 * size to keep the cost of appending constant.
+		 */
+		if (!history_arena_compact(history, live_bytes + required)) {
+			return false;
+		}
+	}
+	*offset = arena->len;
+
+	return buffer_append(arena, line, required);
+}
+
+static void
+history_arena_release(minirl_history_st * const history, history_entry_st const * const entry)
+{
+	history->dead_bytes += entry->len + 1;
+}
+
+static history_entry_st *
+history_entries_alloc(size_t const max_len)
+{
+	/* Leave room for as many removed entries as live ones. */
+	return calloc(max_len, sizeof(history_entry_st) * 2);
+}
+
+/*
+ * Move the live entries down over the removed ones.
+ * The array is only compacted once it is full, and at least half of it is
+ * then removed entries, so the cost is spread across the lines that were
+ * added since it was last compacted.
+ */
+static void
+history_entries_compact(minirl_history_st * const history)
+{
+	size_t keep = 0;
+
+	for (size_t i = history->oldest; i < history->entries_len; i++) {
+		history_entry_st const entry = history->entries[i];
+
+		if (entry.removed) {
+			continue;
+		}
+
+		history_slot_st * const slot =
+			history_index_get(history, entry.hash, entry.id);
+
+		if (slot != NULL) {
+			slot->pos = keep;
+		}
+		history->entries[keep] = entry;
+		keep++;
+	}
+	history->entries_len = keep;
+	history->oldest = 0;
+}
+
+/*
+ * Mark the entry at position 'index' as removed. It is left in place, so
+ * this takes constant time wherever the entry is.
+ */
+static void
+history_entry_remove(
+	minirl_history_st * const history,
+	size_t const index,
+	bool const release_line)
+{
+	history_entry_st * const entry = &history->entries[index];
+
+	/* Only the newest copy of a line is indexed. */
+	history_index_remove(history, entry->hash, entry->id);
+	if (release_line) {
+		history_arena_release(history, entry);
+	}
+	entry->removed = true;
+	history->current_len--;
+
+	while (history->oldest < history->entries_len
+	       && history->entries[history->oldest].removed) {
+		history->oldest++;
+	}
+
+	if (history->current_len == 0) {
+		history->entries_len = 0;
+		history->oldest = 0;
+		if (release_line) {
+			/*
+			 * Nothing left that is live, so the arena can simply
+			 * be reset, unless the line is being kept for another
+			 * entry.
+			 */
+			history->arena.len = 0;
+			history->dead_bytes = 0;
+		}
+	}
+}
+
+/* Remove the oldest entries until 'required' more bytes fit the budget. */
+static void
+history_evict_bytes(minirl_history_st * const history, size_t const required)
+{
+	if (history->max_bytes == 0) {
+		return;
+	}
+	while (history->current_len > 0
+	       && history->arena.len - history->dead_bytes + required > history->max_bytes) {
+		history_entry_remove(history, history->oldest, true);
+	}
+}
+
+/* Drop any entries that are older copies of another entry. */
+static void
+history_remove_duplicates(minirl_history_st * const history)
+{
+	for (size_t i = history->oldest; i < history->entries_len; i++) {
+		history_entry_st * const entry = &history->entries[i];
+
+		if (!entry->removed
+		    && history_index_get(history, entry->hash, entry->id) == NULL) {
+			history_entry_remove(history, i, true);
+		}
+	}
+	history_entries_compact(history);
+}
+
+NO_EXPORT
+minirl_history_st *
+history_new(size_t const max_len)
+{
+	minirl_history_st * const history = calloc(1, sizeof(*history));
+
+	if (history == NULL) {
+		return NULL;
+	}
+	if (pthread_mutex_init(&history->lock, NULL) != 0) {
+		free(history);
+		return NULL;
+	}
+	atomic_init(&history->seq, 0);
+	atomic_init(&history->readers, 0);
+	atomic_init(&history->refs, 1);
+	history->max_len = max_len;
+	history->next_id = 1;
+
+	return history;
+}
+
+static void
+history_destroy(minirl_history_st * const history)
+{
+	history_reclaim(history);
+	history_shm_close(history->shm);
+	free(history->entries);
+	buffer_clear(&history->arena);
+	free(history->index.slots);
+	pthread_mutex_destroy(&history->lock);
+	free(history);
+}
+
+NO_EXPORT
+void
+history_ref(minirl_history_st * const history)
+{
+	atomic_fetch_add(&history->refs, 1);
+}
+
+NO_EXPORT
+void
+history_unref(minirl_history_st * const history)
+{
+	if (history != NULL && atomic_fetch_sub(&history->refs, 1) == 1) {
+		history_destroy(history);
+	}
+}
+
+/*
+ * Add a new entry to the history.
+ * When the history max length is reached the oldest entry is removed to make
+ * room for the new one. Older entries are also removed to keep the text of
+ * the history within the byte budget, if one is set.
+ *
+ * In unique mode an existing copy of the line is found through the hash
+ * index and moved to the newest slot rather than being duplicated.
+ * Removed entries are only marked as such, and are dropped when the entries
+ * array is next compacted, so adding a line takes amortized constant time
+ * however long the history is.
+ */
+static int
+history_add_line(minirl_history_st * const history, char const * const line)
+{
+	if (history->max_len == 0) {
+		return 0;
+	}
+
+	/* Initialization on first call. */
+	if (history->entries == NULL) {
+		history->entries = history_entries_alloc(history->max_len);
+		if (history->entries == NULL) {
+			return 0;
+		}
+	}
+	if (history->index.slots == NULL) {
+		history->index.slots =
+			history_index_alloc(history->max_len, &history->index.mask);
+		if (history->index.slots == NULL) {
+			return 0;
+		}
+	}
+
+	size_t const len = strlen(line);
+	uint32_t const hash = history_hash(line);
+	history_slot_st * const slot = history_index_find(history, line, hash);
+
+	/* Don't add duplicated lines, but do count them as having been used. */
+	if (slot != NULL && slot->pos == history->entries_len - 1) {
+		slot->count++;
+		return 0;
+	}
+
+	history_entry_st entry = { .len = len, .hash = hash };
+	uint32_t count = 1;
+	bool stored = false;
+
+	if (history->max_bytes != 0 && len + 1 > history->max_bytes) {
+		return 0;
+	}
+
+	if (slot != NULL) {
+		count = slot->count + 1;
+		if (history->unique) {
+			/* Reuse the existing copy of the line. */
+			entry.offset = history->entries[slot->pos].offset;
+			history_entry_remove(history, slot->pos, false);
+			stored = true;
+		} else {
+			/* The new entry is indexed in place of the older copy. */
+			history_index_remove(history, hash, slot->id);
+		}
+	}
+
+	/*
+	 * If we reached the max length, remove the older line, and then add
+	 * a copy of the line in the history arena. The line has to be removed
+	 * first, as removing the last entry resets the arena.
+	 */
+	if (history->current_len == history->max_len) {
+		history_entry_remove(history, history->oldest, true);
+	}
+	if (!stored) {
+		history_evict_bytes(history, len + 1);
+		if (!history_arena_store(history, line, len, &entry.offset)) {
+			return 0;
+		}
+	}
+
+	if (history->entries_len == history->max_len * 2) {
+		history_entries_compact(history);
+	}
+	entry.id = history->next_id++;
+	history->entries[history->entries_len] = entry;
+	history_index_insert(history, entry.hash, entry.id, count, history->entries_len);
+	history->entries_len++;
+	history->current_len++;
+
+	return 1;
+}
+
+static int
+history_add(minirl_history_st * const history, char const * const line)
+{
+	struct buffer const * const arena = &history->arena;
+
+	if (line >= arena->b && line < arena->b + arena->len) {
+		/*
+		 * The line is already in the history, and the arena may be
+		 * moved while adding it, so add a copy of it.
+		 */
+		char * const linecopy = strdup(line);
+
+		if (linecopy == NULL) {
+			return 0;
+		}
+
+		int const res = history_add_line(history, linecopy);
+
+		free(linecopy);
+
+		return res;
+	}
+
+	return history_add_line(history, line);
+}
+
+/*
+ * Set the maximum length for the history. This function can be called even
+ * if there is already some history, the function will make sure to retain
+ * just the latest 'len' elements if the new history length value is smaller
+ * than the amount of items already inside the history.
+ */
+static int
+history_set_max_len(minirl_history_st * const history, size_t const len)
+{
+	if (len < 1) {
+		return 0;
+	}
+	if (history->entries != NULL) {
+		size_t const tocopy =
+			(history->current_len < len) ? history->current_len : len;
+		history_entry_st * const new_entries = history_entries_alloc(len);
+		size_t new_mask;
+		history_slot_st * const new_slots = history_index_alloc(len, &new_mask);
+
+		if (new_entries == NULL || new_slots == NULL) {
+			free(new_entries);
+			free(new_slots);
+			return 0;
+		}
+
+		/*
+		 * Copy the newest live entries, and if we can't copy everything,
+		 * release the elements we'll not use.
+		 */
+		size_t j = tocopy;
+
+		for (size_t i = history->entries_len; i > history->oldest; i--) {
+			history_entry_st const * const entry = &history->entries[i - 1];
+
+			if (entry->removed) {
+				continue;
+			}
+			if (j > 0) {
+				j--;
+				new_entries[j] = *entry;
+			} else {
+				history_arena_release(history, entry);
+			}
+		}
+		history_retire(history, history->entries);
+		history->entries = new_entries;
+		history->current_len = tocopy;
+		history->entries_len = tocopy;
+		history->oldest = 0;
+
+		/* Move the index entries of the remaining lines across. */
+		history_slot_st * const old_slots = history->index.slots;
+		size_t const old_mask = history->index.mask;
+
+		history->index.slots = new_slots;
+		history->index.mask = new_mask;
+		for (size_t j = 0; old_slots != NULL && j <= old_mask; j++) {
+			history_slot_st const * const old_slot = &old_slots[j];
+
+			if (old_slot->id == 0) {
+				continue;
+			}
+
+			size_t const pos = history_entry_find_id(history,
+								 0,
+								 history->entries_len,
+								 old_slot->id);
+
+			if (pos != history->entries_len) {
+				history_index_insert(history,
+						     old_slot->hash,
+						     old_slot->id,
+						     old_slot->count,
+						     pos);
+			}
+		}
+		free(old_slots);
+	} else {
+		/* Will be reallocated to the new size by the next add. */
+		free(history->index.slots);
+		history->index.slots = NULL;
+	}
+	history->max_len = len;
+
+	return 1;
+}
+
+/*
+ * Set the maximum number of bytes of text that may be kept in the history,
+ * with 0 indicating no limit. The oldest entries are removed to bring the
+ * history within the new budget.
+ */
+static int
+history_set_max_bytes(minirl_history_st * const history, size_t const max_bytes)
+{
+	history->max_bytes = max_bytes;
+	history_evict_bytes(history, 0);
+
+	return 1;
+}
+
+static int
+history_set_unique(minirl_history_st * const history, bool const unique)
+{
+	if (unique == history->unique) {
+		return 1;
+	}
+
+	if (unique && history->entries != NULL) {
+		history_remove_duplicates(history);
+	}
+	history->unique = unique;
+
+	return 1;
+}
+
+NO_EXPORT
+void
+history_sync(minirl_history_st * const history)
+{
+	history_shm_st * const shm = history_shm_get(history);
+
+	if (shm == NULL
+	    || history_shm_head(shm) == HISTORY_READ(history->shm_cursor)) {
+		return;
+	}
+
+	struct buffer line;
+
+	if (!buffer_init(&line, 0)) {
+		return;
+	}
+
+	history_write_begin(history);
+
+	bool is_own;
+
+	while (history_shm_read(shm, &history->shm_cursor, &line, &is_own)) {
+		if (!is_own) {
+			history_add(history, line.b);
+		}
+	}
+
+	history_write_end(history);
+
+	buffer_clear(&line);
+}
+
+/* Score a line by how often, and how recently, it has been used. */
+static double
+history_frecency(
+	minirl_history_st const * const history,
+	history_slot_st const * const slot)
+{
+	double const age = history->next_id - slot->id - 1;
+
+	return slot->count
+		* HISTORY_FRECENCY_HALF_LIFE / (HISTORY_FRECENCY_HALF_LIFE + age);
+}
+
+typedef struct history_rank_st {
+	size_t index;
+	int fuzzy_score;
+	double score;
+} history_rank_st;
+
+/* Check whether 'a' should be ranked below 'b'. */
+static bool
+history_rank_below(history_rank_st const * const a, history_rank_st const * const b)
+{
+	if (a->fuzzy_score != b->fuzzy_score) {
+		return a->fuzzy_score < b->fuzzy_score;
+	}
+	if (a->score != b->score) {
+		return a->score < b->score;
+	}
+
+	return a->index < b->index;
+}
+
+/*
+ * The ranking is done when asked for, from the use counts and ids kept in
+ * the index, so keeping it up to date costs nothing more than the O(1) hash
+ * index update that is done for every line added.
+ */
+NO_EXPORT
+char **
+history_top(
+	minirl_history_st * const history,
+	char const * const query,
+	size_t const n,
+	bool const fuzzy)
+{
+	history_rank_st * const ranked = calloc(n + 1, sizeof(*ranked));
+
+	if (ranked == NULL) {
+		return NULL;
+	}
+
+	history_sync(history);
+	pthread_mutex_lock(&history->lock);
+
+	size_t const query_len = strlen(query);
+	fuzzy_query_st fuzzy_query;
+	size_t found = 0;
+
+	if (fuzzy) {
+		fuzzy_query_init(&fuzzy_query, query, query_len);
+	}
+
+	for (size_t j = 0; history->index.slots != NULL && j <= history->index.mask; j++) {
+		history_slot_st const * const slot = &history->index.slots[j];
+
+		if (slot->id == 0) {
+			continue;
+		}
+
+		size_t const index = slot->pos;
+		char const * const line = history_line(history, index);
+		history_rank_st rank = { .index = index };
+
+		if (fuzzy) {
+			rank.fuzzy_score = fuzzy_score(&fuzzy_query,
+						       line,
+						       history->entries[index].len);
+			if (rank.fuzzy_score < 0) {
+				continue;
+			}
+		} else if (strncmp(line, query, query_len) != 0) {
+			continue;
+		}
+
+		/*
+		 * Insert into the ranked lines, best first, with the newer of
+		 * two lines with the same score ranked higher.
+		 */
+		size_t pos = found;
+
+		rank.score = history_frecency(history, slot);
+		while (pos > 0 && history_rank_below(&ranked[pos - 1], &rank)) {
+			pos--;
+		}
+		if (pos >= n) {
+			continue;
+		}
+		if (found < n) {
+			found++;
+		}
+		memmove(&ranked[pos + 1], &ranked[pos], sizeof(*ranked) * (found - 1 - pos));
+		ranked[pos] = rank;
+	}
+
+	/* Return the lines and the array of pointers to them in one block. */
+	size_t size = sizeof(char *) * (found + 1);
+
+	for (size_t i = 0; i < found; i++) {
+		size += history->entries[ranked[i].index].len + 1;
+	}
+
+	char ** const lines = malloc(size);
+
+	if (lines != NULL) {
+		char *p = (char *)&lines[found + 1];
+
+		for (size_t i = 0; i < found; i++) {
+			history_entry_st const * const entry = &history->entries[ranked[i].index];
+
+			memcpy(p, history->arena.b + entry->offset, entry->len + 1);
+			lines[i] = p;
+			p += entry->len + 1;
+		}
+		lines[found] = NULL;
+	}
+
+	pthread_mutex_unlock(&history->lock);
+	free(ranked);
+
+	return lines;
+}
+
+NO_EXPORT
+uint64_t
+history_read(
+	minirl_history_st * const history,
+	uint64_t const id,
+	bool const older,
+	struct buffer * const line_buf)
+{
+	uint64_t found_id = 0;
+
+	atomic_fetch_add(&history->readers, 1);
+
+	for (;;) {
+		unsigned long const seq =
+			atomic_load_explicit(&history->seq, memory_order_acquire);
+
+		if ((seq & 1) != 0) {
+			/* Stand aside while a writer is busy. */
+			atomic_fetch_sub(&history->readers, 1);
+			sched_yield();
+			atomic_fetch_add(&history->readers, 1);
+			continue;
+		}
+
+		history_entry_st const * const entries = HISTORY_READ(history->entries);
+		size_t const len = HISTORY_READ(history->entries_len);
+		char const * const arena = HISTORY_READ(history->arena.b);
+		size_t const arena_len = HISTORY_READ(history->arena.len);
+
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&history->seq, memory_order_relaxed) != seq) {
+			continue;
+		}
+
+		/* Find the first entry with an id >= 'id'. */
+		size_t first = 0;
+		size_t last = len;
+
+		while (first < last) {
+			size_t const mid = first + (last - first) / 2;
+
+			if (HISTORY_READ(entries[mid].id) < id) {
+				first = mid + 1;
+			} else {
+				last = mid;
+			}
+		}
+		if (!older && first < len && HISTORY_READ(entries[first].id) == id) {
+			first++;
+		}
+
+		/* Step over any removed entries. */
+		if (older) {
+			while (first > 0 && HISTORY_READ(entries[first - 1].removed)) {
+				first--;
+			}
+			first = (first > 0) ? first - 1 : len;
+		} else {
+			while (first < len && HISTORY_READ(entries[first].removed)) {
+				first++;
+			}
+		}
+
+		bool valid = true;
+
+		found_id = 0;
+		if (first < len) {
+			size_t const offset = HISTORY_READ(entries[first].offset);
+			size_t const entry_len = HISTORY_READ(entries[first].len);
+
+			/* The entry may be torn, so check it before using it. */
+			valid = offset < arena_len && entry_len < arena_len - offset;
+			if (valid) {
+				line_buf->len = 0;
+				if (!buffer_append(line_buf, arena + offset, entry_len)) {
+					break;
+				}
+				found_id = HISTORY_READ(entries[first].id);
+			}
+		}
+
+		atomic_thread_fence(memory_order_acquire);
+		if (valid
+		    && atomic_load_explicit(&history->seq, memory_order_relaxed) == seq) {
+			break;
+		}
+	}
+
+	atomic_fetch_sub(&history->readers, 1);
+
+	return found_id;
+}
+
+minirl_history_st *
+minirl_history_new(void)
+{
+	return history_new(MINIRL_DEFAULT_HISTORY_MAX_LEN);
+}
+
+void
+minirl_history_free(minirl_history_st * const history)
+{
+	history_unref(history);
+}
+
+void
+minirl_history_attach(minirl_st * const minirl, minirl_history_st * const history)
+{
+	history_ref(history);
+	history_unref(minirl->history);
+	minirl->history = history;
+}
+
+int
+minirl_history_add(minirl_st * const minirl, char const * const line)
+{
+	minirl_history_st * const history = minirl->history;
+
+	history_write_begin(history);
+	int const res = history_add(history, line);
+	history_shm_st * const shm = history->shm;
+	history_write_end(history);
+
+	/* Only pass on lines that this history accepted. */
+	if (res > 0 && shm != NULL) {
+		history_shm_publish(shm, line, strlen(line));
+	}
+
+	return res;
+}
+
+int
+minirl_history_set_max_len(minirl_st * const minirl, size_t const len)
+{
+	minirl_history_st * const history = minirl->history;
+
+	history_write_begin(history);
+	int const res = history_set_max_len(history, len);
+	history_write_end(history);
+
+	return res;
+}
+
+int
+minirl_history_set_max_bytes(minirl_st * const minirl, size_t const max_bytes)
+{
+	minirl_history_st * const history = minirl->history;
+
+	history_write_begin(history);
+	int const res = history_set_max_bytes(history, max_bytes);
+	history_write_end(history);
+
+	return res;
+}
+
+int
+minirl_history_set_unique(minirl_st * const minirl, bool const unique)
+{
+	minirl_history_st * const history = minirl->history;
+
+	history_write_begin(history);
+	int const res = history_set_unique(history, unique);
+	history_write_end(history);
+
+	return res;
+}
+
+char **
+minirl_history_top(minirl_st * const minirl, char const * const prefix, size_t const n)
+{
+	return history_top(minirl->history, prefix, n, false);
+}
+
+bool
+minirl_history_shm_attach(minirl_history_st * const history, char const * const name)
+{
+	if (history_shm_get(history) != NULL) {
+		return false;
+	}
+
+	history_shm_st * const shm = history_shm_open(name);
+
+	if (shm == NULL) {
+		return false;
+	}
+
+	history_write_begin(history);
+
+	/* Another thread may have attached a ring in the meantime. */
+	bool const attached = history->shm == NULL;
+
+	if (attached) {
+		/* Start with the lines already in the ring. */
+		history->shm_cursor = 0;
+		__atomic_store_n(&history->shm, shm, __ATOMIC_RELEASE);
+	}
+	history_write_end(history);
+
+	if (!attached) {
+		history_shm_close(shm);
+	}
+
+	return attached;
+}
+
+int
+minirl_history_shm_journal(
+	minirl_history_st * const history,
+	int const fd,
+	uint64_t * const cursor)
+{
+	history_shm_st * const shm = history_shm_get(history);
+
+	if (shm == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	struct buffer journal;
+	struct buffer line;
+	int count = 0;
+	bool is_own;
+
+	if (!buffer_init(&journal, 0)) {
+		return -1;
+	}
+	if (!buffer_init(&line, 0)) {
+		buffer_clear(&journal);
+		return -1;
+	}
+
+	while (history_shm_read(shm, cursor, &line, &is_own)) {
+		if (!buffer_append(&journal, line.b, line.len)
+		    || !buffer_append(&journal, "\n", 1)) {
+			count = -1;
+			break;
+		}
+		count++;
+	}
+
+	if (count > 0 && io_write(fd, journal.b, journal.len) == -1) {
+		count = -1;
+	}
+
+	buffer_clear(&line);
+	buffer_clear(&journal);
+
+	return count;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "minirl.h"
+#include "buffer.h"
+#include "history_shm.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct history_entry_st {
+	/* Location of the NUL terminated line within the history arena. */
+	size_t offset;
+	size_t len;
+	uint32_t hash;
+	/*
+	 * Every entry gets a unique, increasing id when added, so the
+	 * entries array is always sorted by id.
+	 */
+	uint64_t id;
+	/*
+	 * Removed entries are left in place, keeping their id, until the
+	 * entries array is next compacted.
+	 */
+	bool removed;
+} history_entry_st;
+
+/*
+ * There is a slot in the index for every distinct line in the history,
+ * which refers to the newest entry of that line.
+ */
+typedef struct history_slot_st {
+	uint64_t id;            /* 0 indicates an empty slot. */
+	uint32_t hash;
+	uint32_t count;         /* The number of times the line was added. */
+	size_t pos;             /* The position of the entry in the entries array. */
+} history_slot_st;
+
+typedef struct history_retired_st history_retired_st;
+
+struct history_retired_st {
+	history_retired_st *next;
+	void *ptr;
+};
+
+struct minirl_history_st {
+	/*
+	 * Writers are serialised by the lock, and bump 'seq' before and after
+	 * modifying the history, so it is odd while a change is in progress.
+	 * Readers don't take the lock. They instead retry if 'seq' changed
+	 * while they were reading. Memory that a writer replaces is 'retired'
+	 * rather than freed, and only freed once there are no readers.
+	 */
+	pthread_mutex_t lock;
+	atomic_ulong seq;
+	atomic_uint readers;
+	atomic_uint refs;
+	history_retired_st *retired;
+
+	/*
+	 * The entries array has room for twice 'max_len' entries, including
+	 * removed ones, and is compacted when it is full. 'current_len' is the
+	 * number of entries that haven't been removed, and 'oldest' is the
+	 * position of the oldest of them.
+	 */
+	size_t max_len;
+	size_t current_len;
+	size_t entries_len;
+	size_t oldest;
+	history_entry_st *entries;
+	uint64_t next_id;
+
+	/*
+	 * The text of every entry is stored in a single arena. Removing or
+	 * replacing an entry leaves its bytes dead until the arena is next
+	 * compacted.
+	 */
+	struct buffer arena;
+	size_t dead_bytes;
+	size_t max_bytes;       /* 0 indicates no limit. */
+
+	/*
+	 * A hash index of the distinct lines in the history, which also keeps
+	 * count of how often each is used.
+	 * When 'unique' is set, a line added to the history replaces any
+	 * existing copy of it.
+	 */
+	bool unique;
+	struct {
+		history_slot_st *slots;
+		size_t mask;
+	} index;
+
+	/*
+	 * Optional ring in shared memory through which lines are shared with
+	 * other processes, and the sequence number of the next line to be
+	 * imported from it.
+	 */
+	history_shm_st *shm;
+	uint64_t shm_cursor;
+};
+
+/* The id used for the line being edited, which is newer than any entry. */
+#define HISTORY_ID_EDIT_LINE UINT64_MAX
+
+minirl_history_st *
+history_new(size_t max_len);
+
+void
+history_ref(minirl_history_st *history);
+
+void
+history_unref(minirl_history_st *history);
+
+/* Import any lines added to the shared memory ring by other processes. */
+void
+history_sync(minirl_history_st *history);
+
+/*
+ * Get up to 'n' distinct lines starting with 'query', or matching it if
+ * 'fuzzy' is set, best ranked first, in a single allocation.
+ */
+char **
+history_top(minirl_history_st *history, char const *query, size_t n, bool fuzzy);
+
+/*
+ * Copy the newest entry older than 'id', or the oldest entry newer than
+ * 'id', into 'line_buf'.
+ * Returns the id of the copied entry, or 0 if there is no such entry.
+ * Never blocks writers.
+ */
+uint64_t
+history_read(
+	minirl_history_st *history,
+	uint64_t id,
+	bool older,
+	struct buffer *line_buf);
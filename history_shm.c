@@ -0,0 +1,391 @@
+#include "history_shm.h"
+#include "export.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HISTORY_SHM_MAGIC 0x6d726c68u   /* "mrlh" */
+#define HISTORY_SHM_VERSION 1
+#define HISTORY_SHM_NUM_SLOTS 256
+#define HISTORY_SHM_LINE_MAX 1024
+#define HISTORY_SHM_NAME_MAX 256
+/* How long to wait for another process that is busy with a slot. */
+#define HISTORY_SHM_MAX_RETRIES 1000
+/*
+ * How long a reader waits for a line that a later line has overtaken before
+ * taking its producer to have given up or died, and how long it sleeps
+ * between checks meanwhile.
+ */
+#define HISTORY_SHM_ABANDON_NS 200000000L
+#define HISTORY_SHM_WAIT_NS 1000000L
+
+/*
+ * A slot's sequence number is 0 while the slot is unused, 2 * ticket + 1
+ * while the line with that ticket is being written and 2 * ticket + 2 once
+ * it has been written.
+ */
+typedef struct history_shm_slot_st {
+	_Atomic uint64_t seq;
+	uint64_t origin;
+	uint32_t len;
+	char line[HISTORY_SHM_LINE_MAX];
+} history_shm_slot_st;
+
+/*
+ * The layout of the shared memory segment. Producers claim the next ticket
+ * from 'head', and write to the slot that the ticket maps to.
+ */
+typedef struct history_shm_ring_st {
+	_Atomic uint32_t magic;
+	uint32_t version;
+	uint32_t num_slots;
+	uint32_t line_max;
+	_Atomic uint64_t head;
+	history_shm_slot_st slots[HISTORY_SHM_NUM_SLOTS];
+} history_shm_ring_st;
+
+struct history_shm_st {
+	history_shm_ring_st *ring;
+	/* Identifies lines added through this mapping of the ring. */
+	uint64_t origin;
+};
+
+static uint64_t
+history_shm_writing(uint64_t const ticket)
+{
+	return ticket * 2 + 1;
+}
+
+static uint64_t
+history_shm_written(uint64_t const ticket)
+{
+	return ticket * 2 + 2;
+}
+
+static uint64_t
+history_shm_origin(history_shm_st const * const shm)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((uint64_t)getpid() << 32)
+		^ (uint64_t)now.tv_nsec
+		^ (uint64_t)(uintptr_t)shm;
+}
+
+static bool
+history_shm_ring_valid(history_shm_ring_st const * const ring)
+{
+	return ring->version == HISTORY_SHM_VERSION
+		&& ring->num_slots == HISTORY_SHM_NUM_SLOTS
+		&& ring->line_max == HISTORY_SHM_LINE_MAX;
+}
+
+static history_shm_ring_st *
+history_shm_map(char const * const name)
+{
+	size_t const size = sizeof(history_shm_ring_st);
+	bool created = true;
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0660);
+
+	if (fd == -1 && errno == EEXIST) {
+		created = false;
+		fd = shm_open(name, O_RDWR, 0);
+	}
+	if (fd == -1) {
+		return NULL;
+	}
+
+	if (created && ftruncate(fd, size) == -1) {
+		close(fd);
+		shm_unlink(name);
+		return NULL;
+	}
+
+	/* Wait for the creator to size the segment. */
+	for (int retries = 0; !created; retries++) {
+		struct stat st;
+
+		if (fstat(fd, &st) == -1 || retries == HISTORY_SHM_MAX_RETRIES) {
+			close(fd);
+			return NULL;
+		}
+		if ((size_t)st.st_size >= size) {
+			break;
+		}
+		sched_yield();
+	}
+
+	history_shm_ring_st * const ring =
+		mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	close(fd);
+	if (ring == MAP_FAILED) {
+		return NULL;
+	}
+
+	if (created) {
+		/* The segment is zero filled, so all slots start off unused. */
+		ring->version = HISTORY_SHM_VERSION;
+		ring->num_slots = HISTORY_SHM_NUM_SLOTS;
+		ring->line_max = HISTORY_SHM_LINE_MAX;
+		atomic_store_explicit(&ring->magic,
+				      HISTORY_SHM_MAGIC,
+				      memory_order_release);
+	}
+
+	/* Wait for the creator to initialise the ring. */
+	for (int retries = 0;
+	     atomic_load_explicit(&ring->magic, memory_order_acquire) != HISTORY_SHM_MAGIC;
+	     retries++) {
+		if (retries == HISTORY_SHM_MAX_RETRIES) {
+			munmap(ring, size);
+			return NULL;
+		}
+		sched_yield();
+	}
+
+	if (!history_shm_ring_valid(ring)) {
+		munmap(ring, size);
+		return NULL;
+	}
+
+	return ring;
+}
+
+NO_EXPORT
+history_shm_st *
+history_shm_open(char const * const name)
+{
+	char shm_name[HISTORY_SHM_NAME_MAX];
+
+	/* Shared memory object names must start with a '/'. */
+	int const res = snprintf(shm_name,
+				 sizeof shm_name,
+				 "%s%s",
+				 (name[0] == '/') ? "" : "/",
+				 name);
+
+	if (res < 0 || (size_t)res >= sizeof shm_name) {
+		return NULL;
+	}
+
+	history_shm_st * const shm = calloc(1, sizeof(*shm));
+
+	if (shm == NULL) {
+		return NULL;
+	}
+
+	shm->ring = history_shm_map(shm_name);
+	if (shm->ring == NULL) {
+		free(shm);
+		return NULL;
+	}
+	shm->origin = history_shm_origin(shm);
+
+	return shm;
+}
+
+NO_EXPORT
+void
+history_shm_close(history_shm_st * const shm)
+{
+	if (shm != NULL) {
+		munmap(shm->ring, sizeof(*shm->ring));
+		free(shm);
+	}
+}
+
+/*
+ * Lines are added without any locking. Each producer claims a ticket, and
+ * then the slot for that ticket by moving it into the 'writing' state.
+ * The only time a producer has to wait is when the ring has wrapped while
+ * another producer is still writing to the same slot. A producer that has
+ * been overtaken by a newer one for its slot simply drops its line.
+ * A ticket whose line is never written, because its producer gave up or
+ * died, only holds up readers for a bounded time once a later line has
+ * been written.
+ */
+NO_EXPORT
+void
+history_shm_publish(
+	history_shm_st * const shm,
+	char const * const line,
+	size_t const len)
+{
+	history_shm_ring_st * const ring = shm->ring;
+
+	if (len > HISTORY_SHM_LINE_MAX) {
+		return;
+	}
+
+	uint64_t const ticket = atomic_fetch_add(&ring->head, 1);
+	history_shm_slot_st * const slot = &ring->slots[ticket % HISTORY_SHM_NUM_SLOTS];
+	uint64_t seq = atomic_load(&slot->seq);
+
+	for (int retries = 0; ; retries++) {
+		if (seq >= history_shm_written(ticket)) {
+			/* A newer line already has the slot. */
+			return;
+		}
+		if ((seq & 1) != 0) {
+			/* Still being written. Give up on the line if it stays that way. */
+			if (retries == HISTORY_SHM_MAX_RETRIES) {
+				return;
+			}
+			sched_yield();
+			seq = atomic_load(&slot->seq);
+			continue;
+		}
+		if (atomic_compare_exchange_weak(&slot->seq,
+						 &seq,
+						 history_shm_writing(ticket))) {
+			break;
+		}
+	}
+
+	slot->origin = shm->origin;
+	slot->len = len;
+	memcpy(slot->line, line, len);
+	atomic_store_explicit(&slot->seq,
+			      history_shm_written(ticket),
+			      memory_order_release);
+}
+
+NO_EXPORT
+uint64_t
+history_shm_head(history_shm_st const * const shm)
+{
+	return atomic_load_explicit(&shm->ring->head, memory_order_acquire);
+}
+
+/* Whether any line after 'ticket' has been written. */
+static bool
+history_shm_overtaken(
+	history_shm_ring_st const * const ring,
+	uint64_t const ticket,
+	uint64_t const head)
+{
+	for (uint64_t later = ticket + 1; later < head; later++) {
+		history_shm_slot_st const * const slot =
+			&ring->slots[later % HISTORY_SHM_NUM_SLOTS];
+
+		if (atomic_load_explicit(&slot->seq, memory_order_acquire)
+		    >= history_shm_written(later)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Wait for the line with 'ticket' to be written to 'slot', for a bounded
+ * time, and return the slot's sequence number then.
+ * Its producer is most likely only preempted, so the line usually turns up
+ * in a few milliseconds. If it doesn't, the producer has most likely given
+ * up on the slot or died, and readers mustn't wait for it forever.
+ */
+static uint64_t
+history_shm_wait_written(
+	history_shm_slot_st const * const slot,
+	uint64_t const ticket)
+{
+	struct timespec const pause = { .tv_nsec = HISTORY_SHM_WAIT_NS };
+	struct timespec start;
+	struct timespec now;
+	uint64_t seq;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (;;) {
+		seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+		if (seq >= history_shm_written(ticket)) {
+			break;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if ((now.tv_sec - start.tv_sec) * 1000000000L
+		    + (now.tv_nsec - start.tv_nsec) >= HISTORY_SHM_ABANDON_NS) {
+			break;
+		}
+		nanosleep(&pause, NULL);
+	}
+
+	return seq;
+}
+
+NO_EXPORT
+bool
+history_shm_read(
+	history_shm_st const * const shm,
+	uint64_t * const cursor,
+	struct buffer * const line,
+	bool * const is_own)
+{
+	history_shm_ring_st * const ring = shm->ring;
+	uint64_t const head = history_shm_head(shm);
+
+	if (head - *cursor > HISTORY_SHM_NUM_SLOTS) {
+		/* Some lines have been overwritten since the last read. */
+		*cursor = head - HISTORY_SHM_NUM_SLOTS;
+	}
+
+	for (; *cursor < head; (*cursor)++) {
+		history_shm_slot_st const * const slot =
+			&ring->slots[*cursor % HISTORY_SHM_NUM_SLOTS];
+		uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+
+		if (seq < history_shm_written(*cursor)) {
+			if (!history_shm_overtaken(ring, *cursor, head)) {
+				/* Not written yet, so try again on the next read. */
+				return false;
+			}
+			/*
+			 * The lines after it are only read once it's been
+			 * written, so that it isn't lost, unless it's taken
+			 * so long that it must have been abandoned.
+			 */
+			seq = history_shm_wait_written(slot, *cursor);
+			if (seq < history_shm_written(*cursor)) {
+				continue;
+			}
+		}
+		if (seq > history_shm_written(*cursor)) {
+			/* Overwritten by a newer line. */
+			continue;
+		}
+
+		uint64_t const origin = slot->origin;
+		uint32_t const len = slot->len;
+
+		if (len > HISTORY_SHM_LINE_MAX) {
+			continue;
+		}
+		line->len = 0;
+		if (!buffer_append(line, slot->line, len)) {
+			return false;
+		}
+
+		/* Check that the slot wasn't reused while it was being copied. */
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) {
+			continue;
+		}
+
+		*is_own = origin == shm->origin;
+		(*cursor)++;
+
+		return true;
+	}
+
+	return false;
+}
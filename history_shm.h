@@ -0,0 +1,36 @@
+#pragma once
+
+#include "buffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct history_shm_st history_shm_st;
+
+history_shm_st *
+history_shm_open(char const *name);
+
+void
+history_shm_close(history_shm_st *shm);
+
+/* Add a line to the ring. Lines that don't fit in a slot aren't added. */
+void
+history_shm_publish(history_shm_st *shm, char const *line, size_t len);
+
+/* Get the sequence number that the next line added will be given. */
+uint64_t
+history_shm_head(history_shm_st const *shm);
+
+/*
+ * Copy the line with sequence number '*cursor', or the oldest line after it
+ * that is still in the ring, into 'line' and move the cursor on past it.
+ * 'is_own' is set if the line was added through this 'shm'.
+ * Returns false if there are no more lines to read.
+ */
+bool
+history_shm_read(
+	history_shm_st const *shm,
+	uint64_t *cursor,
+	struct buffer *line,
+	bool *is_own);
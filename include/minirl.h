@@ -11,6 +11,14 @@ extern "C"
 #include <stdio.h>
 
 typedef struct minirl_st minirl_st;
+typedef struct minirl_history_st minirl_history_st;
+typedef struct minirl_command_st minirl_command_st;
+
+/* A string that needn't be NUL terminated. */
+typedef struct minirl_span_st {
+	char const *s;
+	size_t len;
+} minirl_span_st;
 
 typedef bool (*minirl_key_binding_handler_cb)(
 	minirl_st *minirl, char const *key, void *user_ctx);
@@ -52,10 +60,26 @@ minirl_text_len_insert(minirl_st *minirl, char const *text, size_t length);
 bool
 minirl_text_insert(minirl_st *minirl, char const *text);
 
+/*
+ * Replace the text between start and end with 'length' characters pointed to
+ * by 'text', leaving the editing position after them.
+ */
+bool
+minirl_text_replace(
+	minirl_st *minirl,
+	size_t start,
+	size_t end,
+	char const *text,
+	size_t length);
+
 /* Get the current terminal width. */
 int
 minirl_terminal_width(minirl_st *minirl);
 
+/* Get the current terminal height. */
+int
+minirl_terminal_height(minirl_st *minirl);
+
 /*
  * Given a list of possible completions, attempt to complete the current word
  * as much as possible.
@@ -68,10 +92,203 @@ bool minirl_complete(
 	char **matches,
 	bool allow_prefix);
 
+/*
+ * Callback that produces the completions for 'line', with the cursor at
+ * 'point'. It sets '*start' to the start of the text the matches replace.
+ * Returns a NULL terminated array of matches, which the library frees along
+ * with each match using free(), or NULL if there are none.
+ */
+typedef char **(*minirl_completion_cb)(
+	char const *line,
+	size_t point,
+	unsigned *start,
+	void *user_ctx);
+
+/*
+ * Request completions from 'cb' without waiting for them, e.g. from a key
+ * handler bound to Tab. 'cb' is called on a worker thread with a copy of the
+ * line, so it mustn't use 'minirl'. The user can carry on editing meanwhile.
+ * When the matches arrive they are used as by minirl_complete(), but only if
+ * the line is still the same, and no newer request has been made.
+ * minirl_delete() waits for any call to 'cb' that is in progress, so 'cb'
+ * should be short, or give up after a while, e.g. on a slow network query.
+ */
+bool
+minirl_complete_async(
+	minirl_st *minirl,
+	minirl_completion_cb cb,
+	bool allow_prefix,
+	void *user_ctx);
+
+/*
+ * Complete the current word as minirl_complete() does, using matches from
+ * 'cb', which are cached. 'token' identifies the context the word is
+ * completed in, e.g. the node of a command grammar.
+ * While the token and the line before the word stay the same, and the word
+ * is only extended without a space being typed, the cached matches are
+ * narrowed down to those starting with the word rather than calling 'cb'
+ * again. With fuzzy matching enabled they're all kept, and ranked against
+ * the word instead.
+ * The cache is cleared for every new line.
+ */
+bool
+minirl_complete_cached(
+	minirl_st *minirl,
+	void const *token,
+	minirl_completion_cb cb,
+	bool allow_prefix,
+	void *user_ctx);
+
+/* Clear the cached matches, e.g. when the set of matches may have changed. */
+void
+minirl_complete_cache_clear(minirl_st *minirl);
+
+/*
+ * Menu completion, e.g. from a key handler bound to Tab: rather than listing
+ * the matches from 'cb', replace the word with the first of them. Calling
+ * this again without the line having been edited in the meantime replaces
+ * it with the next match, without calling 'cb' again, and after the last
+ * match the word is restored as typed. If 'reverse' is set the matches are
+ * cycled through in reverse, e.g. for Shift-Tab.
+ */
+bool
+minirl_complete_menu(
+	minirl_st *minirl,
+	minirl_completion_cb cb,
+	bool reverse,
+	void *user_ctx);
+
+/*
+ * Add 'cb' as one of the sources of matches that minirl_complete_sources()
+ * combines, e.g. one each for command keywords, configuration object names
+ * and words from the history.
+ */
+bool
+minirl_complete_source_add(
+	minirl_st *minirl,
+	minirl_completion_cb cb,
+	void *user_ctx);
+
+/*
+ * Complete the word at the cursor as minirl_complete() does, using the
+ * matches from all the sources added, with any duplicates removed.
+ * The sources are called at the same time, on worker threads, so they
+ * mustn't use 'minirl', and this takes as long as the slowest of them.
+ * The first source to return any matches sets the start of the text they
+ * replace, and any source that sets a different start is ignored.
+ */
+bool
+minirl_complete_sources(minirl_st *minirl, bool allow_prefix);
+
+/*
+ * Create the root of a tree of commands, which is used to complete the
+ * words of a line. Each word of a command is a node in the tree, the
+ * children of which are the words that can follow it.
+ */
+minirl_command_st *
+minirl_command_tree_new(void);
+
+/* Free a command tree, including all the nodes added to it. */
+void
+minirl_command_tree_free(minirl_command_st *root);
+
+/*
+ * Add a word, which mustn't contain spaces, that can follow 'parent'.
+ * Returns the node for the word, which is the existing node if the word has
+ * already been added, or NULL on error.
+ */
+minirl_command_st *
+minirl_command_add(minirl_command_st *parent, char const *name);
+
+/*
+ * Complete the word at the cursor as minirl_complete() does, using the
+ * words that can follow the preceding words of the line in the command tree.
+ * The preceding words may be abbreviated, so long as they're unambiguous.
+ * With fuzzy matching enabled, all the words that can follow are ranked
+ * against the word at the cursor.
+ */
+bool
+minirl_complete_command(
+	minirl_st *minirl,
+	minirl_command_st const *root,
+	bool allow_prefix);
+
 /* Display the set of matches on the terminal. */
 void
 minirl_display_matches(minirl_st *minirl, char **matches);
 
+/*
+ * As minirl_complete(), but with the matches given as an array of 'count'
+ * spans, which can point into the application's own data rather than each
+ * being a separate NUL terminated string.
+ */
+bool
+minirl_complete_spans(
+	minirl_st *minirl,
+	unsigned start,
+	minirl_span_st const *matches,
+	size_t count,
+	bool allow_prefix);
+
+/*
+ * Set the number of matches at or above which the user is asked whether to
+ * display them all. Setting to 0 indicates the user is never asked.
+ * Defaults to 100.
+ * Matches that don't fit on the screen are displayed a page at a time.
+ */
+void
+minirl_complete_set_query_items(minirl_st *minirl, size_t query_items);
+
+/*
+ * Enable or disable fuzzy matching. When enabled, the word being completed
+ * and the history search query match any text containing their characters
+ * in the same order, e.g. "swc" matches "show-config". Matches are ranked
+ * by how well they match, with consecutive characters and characters at
+ * the start of words scoring higher. Case is ignored unless the query
+ * contains upper case letters.
+ * Applications should pass all the candidates for the word to
+ * minirl_complete() in this mode, rather than only those it starts.
+ * Disabled by default.
+ */
+void
+minirl_fuzzy_enable(minirl_st *minirl, bool enable);
+
+/*
+ * Enable or disable reading no more input than is needed for each line.
+ * By default whatever input is available is read at once, so that pasted
+ * text is handled in bulk, and anything after the end of the line is kept
+ * for the next call to minirl_readline(). When enabled, nothing after the
+ * key that ends the line is taken from the input, e.g. so that a program
+ * run with the line can read what was typed after it, at the cost of a
+ * read() per byte.
+ * Disabled by default.
+ */
+void
+minirl_exact_input_enable(minirl_st *minirl, bool enable);
+
+/*
+ * Score how well 'candidate', of length 'len', fuzzy matches 'query'.
+ * Returns -1 if it doesn't match, otherwise higher scores are better.
+ */
+int
+minirl_fuzzy_score(char const *query, char const *candidate, size_t len);
+
+/*
+ * Score each of 'count' candidates against 'query' as minirl_fuzzy_score()
+ * does, storing the scores in 'scores', which is faster than scoring them
+ * one by one. Returns the number of candidates that match.
+ */
+size_t
+minirl_fuzzy_scores(
+	char const *query,
+	minirl_span_st const *candidates,
+	size_t count,
+	int *scores);
+
+/* As minirl_display_matches(), but with the matches given as spans. */
+void
+minirl_display_spans(minirl_st *minirl, minirl_span_st const *matches, size_t count);
+
 /* Bind a key handler to a key. */
 bool
 minirl_bind_key(
@@ -94,6 +311,8 @@ minirl_bind_key_sequence(
 /*
  * The main 'readline' function.
  * 'prompt' is displayed at the start of the line.
+ * Escape sequences in it, and any text between '\001' and '\002', aren't
+ * counted towards its width.
  */
 char *
 minirl_readline(minirl_st *minirl, char const *prompt);
@@ -102,6 +321,66 @@ minirl_readline(minirl_st *minirl, char const *prompt);
 void
 minirl_line_free(void *ptr);
 
+/*
+ * Create a history that can be shared by several minirl instances by
+ * attaching it to each of them. Lines added through any of those instances
+ * are visible to all of them.
+ * A shared history may be added to and browsed from several threads at once.
+ * Readers never block threads adding lines.
+ */
+minirl_history_st *
+minirl_history_new(void);
+
+/*
+ * Release a history created by minirl_history_new(). It is freed once it is
+ * no longer attached to any minirl instance.
+ */
+void
+minirl_history_free(minirl_history_st *history);
+
+/*
+ * Use 'history' as the history of this minirl instance, in place of its
+ * current history. The history functions below then apply to 'history'.
+ */
+void
+minirl_history_attach(minirl_st *minirl, minirl_history_st *history);
+
+/*
+ * Get up to 'n' distinct lines from the history that start with 'prefix',
+ * ranked by "frecency", i.e. how often and how recently each has been used,
+ * best first.
+ * Returns a NULL terminated array, or NULL on error. The array and the lines
+ * are a single allocation, to be freed using minirl_line_free().
+ */
+char **
+minirl_history_top(minirl_st *minirl, char const *prefix, size_t n);
+
+/*
+ * Share 'history' with other processes through the named shared memory
+ * object 'name', which is created if it doesn't exist yet. Lines added by
+ * any process attached to the same name become visible to the others when
+ * they next browse their history, without any file being re-read. Lines
+ * already in the shared memory are also made visible.
+ * Only the most recent 256 lines, of up to 1024 bytes each, are kept in the
+ * shared memory. The object remains until removed with shm_unlink().
+ */
+bool
+minirl_history_shm_attach(minirl_history_st *history, char const *name);
+
+/*
+ * Write the lines added to the shared memory attached to 'history' since
+ * '*cursor' to 'fd', one per line, and advance '*cursor' past them.
+ * '*cursor' should initially be 0. Lines that were overwritten before being
+ * written out are skipped. A line that another process has started to add,
+ * but that later lines have overtaken, is waited for for up to 200ms before
+ * it is taken to have been abandoned.
+ * This can be called from a separate thread to keep a history file up to
+ * date without delaying the threads that are adding lines.
+ * Returns the number of lines written, or -1 on error.
+ */
+int
+minirl_history_shm_journal(minirl_history_st *history, int fd, uint64_t *cursor);
+
 /* Add a line to the history. Access the history using the up/down arrows. */
 int
 minirl_history_add(minirl_st *minirl, char const *line);
@@ -114,6 +393,34 @@ minirl_history_add(minirl_st *minirl, char const *line);
 int
 minirl_history_set_max_len(minirl_st *minirl, size_t len);
 
+/*
+ * Set the maximum number of bytes of text kept in the history, including a
+ * terminator for each line. The oldest entries are removed as required to
+ * stay within this limit as well as the maximum length.
+ * Setting to 0 indicates there is no limit, which is the default.
+ */
+int
+minirl_history_set_max_bytes(minirl_st *minirl, size_t max_bytes);
+
+/*
+ * Enable or disable unique history mode.
+ * When enabled, adding a line that is already in the history moves the
+ * existing entry to the newest position rather than adding another copy.
+ * Enabling this mode removes any existing duplicates, keeping the newest.
+ * Disabled by default.
+ */
+int
+minirl_history_set_unique(minirl_st *minirl, bool unique);
+
+/*
+ * Enable or disable autosuggestions. When enabled, the newest history entry
+ * that extends the line is shown dimmed after the cursor as the line is
+ * typed, and the right arrow or End key adds it to the line.
+ * Disabled by default.
+ */
+void
+minirl_history_suggestions_enable(minirl_st *minirl, bool enable);
+
 /* Clear the screen. */
 void
 minirl_screen_clear(minirl_st *minirl);
@@ -1,7 +1,9 @@
 #include "minirl.h"
 #include "buffer.h"
 #include "char.h"
+#include "complete.h"
 #include "export.h"
+#include "history.h"
 #include "io.h"
 #include "private.h"
 #include "utils.h"
@@ -10,6 +12,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdbool.h>
@@ -23,23 +26,104 @@
 
 
 #define DEFAULT_TERMINAL_WIDTH 80
-#define ESCAPESTR "\x1b"
+#define DEFAULT_TERMINAL_HEIGHT 24
+/*
+ * Text in the prompt between these takes no room on the screen, as with
+ * readline. They're needed only for escape sequences that aren't recognised.
+ */
+#define PROMPT_START_IGNORE '\001'
+#define PROMPT_END_IGNORE '\002'
+
+/* Count the bytes of 's' that aren't plain ASCII. */
+static size_t
+non_ascii_count(char const * const s, size_t const len)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		count += !char_is_plain_ascii(s[i]);
+	}
+
+	return count;
+}
 
+static bool
+minirl_state_line_is_ascii(minirl_state_st const * const l)
+{
+	return l->non_ascii == 0;
+}
 
-enum KEY_ACTION
+/* Recount the bytes that aren't plain ASCII after the line is replaced. */
+static void
+minirl_state_line_recount(minirl_state_st * const l)
 {
-	KEY_NULL = 0,		/* NULL */
-	TAB = 9,		/* Tab */
-	ENTER = 13,		/* Enter */
-	ESC = 27,		/* Escape */
-	BACKSPACE =  127	/* Backspace */
-};
+	l->non_ascii = non_ascii_count(l->line_buf->b, l->len);
+}
+
+/* Account for the text from 'start' to 'end' being removed from the line. */
+static void
+minirl_state_line_removing(
+	minirl_state_st * const l,
+	size_t const start,
+	size_t const end)
+{
+	if (l->non_ascii > 0) {
+		l->non_ascii -= non_ascii_count(l->line_buf->b + start, end - start);
+	}
+	l->flags.text_removed = true;
+}
+
+static size_t
+line_grapheme_next(minirl_state_st const * const l, size_t const point)
+{
+	if (minirl_state_line_is_ascii(l)) {
+		return ascii_char_next(l->line_buf->b, l->len, point);
+	}
+
+	return grapheme_next(l->line_buf->b, l->len, point);
+}
+
+static size_t
+line_grapheme_prev(minirl_state_st const * const l, size_t const point)
+{
+	if (minirl_state_line_is_ascii(l)) {
+		return ascii_char_prev(l->line_buf->b, l->len, point);
+	}
+
+	return grapheme_prev(l->line_buf->b, l->len, point);
+}
+
+/*
+ * Words are made of letters, digits and the like, and are separated by
+ * spaces and punctuation, so that e.g. each part of a path or an IP address
+ * is a word.
+ */
+static size_t
+line_word_next(minirl_state_st const * const l, size_t const point)
+{
+	if (minirl_state_line_is_ascii(l)) {
+		return ascii_word_next(l->line_buf->b, l->len, point);
+	}
+
+	return word_next(l->line_buf->b, l->len, point);
+}
+
+static size_t
+line_word_prev(minirl_state_st const * const l, size_t const point)
+{
+	if (minirl_state_line_is_ascii(l)) {
+		return ascii_word_prev(l->line_buf->b, l->len, point);
+	}
+
+	return word_prev(l->line_buf->b, l->len, point);
+}
 
 typedef struct internal_line_buffer_st {
 	size_t edit_point;
 	size_t end;
 	char * alloced_buffer;
 	char const * buffer;
+	bool ascii; /* Whether the buffer is all plain ASCII. */
 } internal_line_buffer_st;
 
 static bool
@@ -64,28 +148,43 @@ internal_line_buffer_init(
 		internal->end = l->len;
 		internal->alloced_buffer = NULL;
 		internal->buffer = l->line_buf->b;
+		internal->ascii = minirl_state_line_is_ascii(l);
 	}
 	else if (echo->ch == '\0') {
 		internal->edit_point = 0;
 		internal->end = 0;
 		internal->alloced_buffer = NULL;
 		internal->buffer = "";
+		internal->ascii = true;
+	} else if (minirl_state_line_is_ascii(l)) {
+		/* Each byte is a character, so is replaced by one echo char. */
+		internal->edit_point = l->pos;
+		internal->end = l->len;
+		internal->alloced_buffer = chrdup(echo->ch, internal->end);
+		internal->buffer = internal->alloced_buffer;
+		internal->ascii = char_is_plain_ascii(echo->ch);
 	} else {
 		/* Replace the line with echo char. */
+		grapheme_cursor_st graphemes;
+		size_t start;
+		size_t end;
+
 		internal->edit_point = 0;
 		internal->end = 0;
-		for (size_t i = 0; ; i = grapheme_next(l->line_buf->b, l->len, i)) {
-			if (i == l->pos) {
+		grapheme_cursor_init(&graphemes, l->line_buf->b, l->len, 0);
+		while (grapheme_cursor_next(&graphemes, &start, &end, NULL)) {
+			if (start == l->pos) {
 				internal->edit_point = internal->end;
 			}
-			if (i >= l->len) {
-				break;
-			}
 			internal->end++;
 		}
+		if (l->pos >= l->len) {
+			internal->edit_point = internal->end;
+		}
 
 		internal->alloced_buffer = chrdup(echo->ch, internal->end);
 		internal->buffer = internal->alloced_buffer;
+		internal->ascii = char_is_plain_ascii(echo->ch);
 	}
 
 	return internal->buffer != NULL;
@@ -144,8 +243,19 @@ minirl_state_reset_line_state(minirl_state_st * const l)
 static void
 move_edit_position_right(minirl_state_st * const l)
 {
-	if (l->pos < l->len) {
-		l->pos = grapheme_next(l->line_buf->b, l->len, l->pos);
+	grapheme_cursor_st graphemes;
+	size_t start;
+
+	if (minirl_state_line_is_ascii(l)) {
+		if (l->pos < l->len) {
+			l->pos++;
+			minirl_state_cursor_refresh_required(l);
+		}
+		return;
+	}
+
+	grapheme_cursor_init(&graphemes, l->line_buf->b, l->len, l->pos);
+	if (grapheme_cursor_next(&graphemes, &start, &l->pos, NULL)) {
 		minirl_state_cursor_refresh_required(l);
 	}
 }
@@ -153,8 +263,19 @@ move_edit_position_right(minirl_state_st * const l)
 static void
 move_edit_position_left(minirl_state_st * const l)
 {
-	if (l->pos > 0) {
-		l->pos = grapheme_prev(l->line_buf->b, l->len, l->pos);
+	grapheme_cursor_st graphemes;
+	size_t end;
+
+	if (minirl_state_line_is_ascii(l)) {
+		if (l->pos > 0) {
+			l->pos--;
+			minirl_state_cursor_refresh_required(l);
+		}
+		return;
+	}
+
+	grapheme_cursor_init(&graphemes, l->line_buf->b, l->len, l->pos);
+	if (grapheme_cursor_prev(&graphemes, &l->pos, &end, NULL)) {
 		minirl_state_cursor_refresh_required(l);
 	}
 }
@@ -276,6 +397,19 @@ minirl_terminal_width(minirl_st * const minirl)
 	return cols;
 }
 
+int
+minirl_terminal_height(minirl_st * const minirl)
+{
+	int rows = DEFAULT_TERMINAL_HEIGHT;
+	struct winsize ws;
+
+	if (ioctl(minirl->out.fd, TIOCGWINSZ, &ws) != -1 && ws.ws_row != 0) {
+		rows = ws.ws_row;
+	}
+
+	return rows;
+}
+
 /* Clear the screen. Used to handle ctrl+l */
 void
 minirl_screen_clear(minirl_st * const minirl)
@@ -290,16 +424,86 @@ minirl_screen_clear(minirl_st * const minirl)
 	minirl_state_refresh_required(l);
 }
 
+/* Move the cursor on by 'count' characters that are each one column wide. */
+static void
+cursor_advance(cursor_st * const cursor, size_t const count, size_t const row_width)
+{
+	size_t const room = (cursor->col < row_width) ? row_width - cursor->col : 0;
+
+	if (count <= room) {
+		cursor->col += count;
+		return;
+	}
+
+	/* Each further row is filled before wrapping onto the next. */
+	size_t const rest = count - room;
+
+	cursor->row += (rest + row_width - 1) / row_width;
+	cursor->col = (rest - 1) % row_width + 1;
+}
+
+/*
+ * As string_wrap(), for a string that's all plain ASCII, in which anything
+ * but a printable character is a control character with no width.
+ */
+static void
+string_wrap_ascii(
+	char const * const s,
+	size_t const len,
+	size_t const row_width,
+	cursor_st * const cursor)
+{
+	size_t point = 0;
+
+	while (point < len) {
+		size_t const run_end = char_ascii_run(s, len, point);
+
+		if (run_end > point) {
+			cursor_advance(cursor, run_end - point, row_width);
+			point = run_end;
+			continue;
+		}
+
+		if (s[point] == '\n') {
+			cursor->row++;
+			cursor->col = 0;
+		}
+		point++;
+	}
+}
+
 static void
 string_wrap(
 	char const * const s,
 	size_t const len,
+	bool const ascii,
 	size_t const row_width,
 	cursor_st * const cursor)
 {
-	for (size_t point = 0; point < len;) {
-		size_t next;
-		size_t const width = grapheme_width(s, len, point, &next);
+	grapheme_cursor_st graphemes;
+	size_t point = 0;
+
+	if (ascii && row_width > 0) {
+		string_wrap_ascii(s, len, row_width, cursor);
+		return;
+	}
+
+	grapheme_cursor_init(&graphemes, s, len, point);
+	while (point < len) {
+		/* Skip over runs of printable ASCII in one go. */
+		size_t const run_end = (row_width > 0) ? char_ascii_run(s, len, point) : point;
+
+		if (run_end > point) {
+			cursor_advance(cursor, run_end - point, row_width);
+			point = run_end;
+			grapheme_cursor_init(&graphemes, s, len, point);
+			continue;
+		}
+
+		size_t start;
+		size_t width;
+
+		grapheme_cursor_next(&graphemes, &start, &point, &width);
 
 		if (width > 0) {
 			cursor->col += width;
@@ -307,7 +511,7 @@ string_wrap(
 				cursor->row++;
 				cursor->col = width;
 			}
-		} else if (s[point] == '\n') {
+		} else if (s[start] == '\n') {
 			/*
 			 * Special case for '\n', which moves the cursor
 			 * to the beginning of the next line.
@@ -318,10 +522,112 @@ string_wrap(
 			cursor->row++;
 			cursor->col = 0;
 		}
-		point = next;
 	}
 }
 
+/*
+ * Get the end of the escape sequence starting at 'point', which is a CSI
+ * sequence such as those that set colours, an OSC sequence such as those
+ * that set the window title, or ESC followed by a single command.
+ */
+static size_t
+escape_sequence_end(char const * const s, size_t const len, size_t const point)
+{
+	size_t end = point + 1;
+
+	if (end >= len) {
+		return len;
+	}
+
+	if (s[end] == '[') {
+		/* Parameter and intermediate bytes, then the final byte. */
+		end++;
+		while (end < len && s[end] >= 0x20 && s[end] <= 0x3f) {
+			end++;
+		}
+		if (end < len && s[end] >= 0x40 && s[end] <= 0x7e) {
+			end++;
+		}
+	} else if (s[end] == ']') {
+		/* Ended by BEL or ST (ESC \). */
+		for (end++; end < len; end++) {
+			if (s[end] == '\a') {
+				return end + 1;
+			}
+			if (s[end] == ESC && end + 1 < len && s[end + 1] == '\\') {
+				return end + 2;
+			}
+		}
+	} else {
+		/* Intermediate bytes, then the final byte. */
+		while (end < len && s[end] >= 0x20 && s[end] <= 0x2f) {
+			end++;
+		}
+		if (end < len && s[end] >= 0x30 && s[end] <= 0x7e) {
+			end++;
+		}
+	}
+
+	return end;
+}
+
+/*
+ * As string_wrap(), but skipping anything in the prompt that doesn't take
+ * any room on the screen.
+ */
+static void
+prompt_wrap(
+	char const * const prompt,
+	size_t const len,
+	bool const ascii,
+	size_t const row_width,
+	cursor_st * const cursor)
+{
+	size_t start = 0;
+	size_t point = 0;
+
+	while (point < len) {
+		size_t end;
+
+		if (prompt[point] == ESC) {
+			end = escape_sequence_end(prompt, len, point);
+		} else if (prompt[point] == PROMPT_START_IGNORE) {
+			char const * const ignore_end =
+				memchr(prompt + point, PROMPT_END_IGNORE, len - point);
+
+			end = (ignore_end != NULL) ? ignore_end - prompt + 1 : len;
+		} else {
+			point++;
+			continue;
+		}
+		string_wrap(prompt + start, point - start, ascii, row_width, cursor);
+		start = point = end;
+	}
+	string_wrap(prompt + start, point - start, ascii, row_width, cursor);
+}
+
+/* Work out where the prompt leaves the cursor. */
+static void
+minirl_state_prompt_measure(minirl_state_st * const l)
+{
+	l->prompt_end = (cursor_st){ 0 };
+	prompt_wrap(l->prompt, l->prompt_len, l->prompt_ascii,
+		l->terminal_width, &l->prompt_end);
+	l->prompt_end_width = l->terminal_width;
+}
+
+static void
+minirl_state_prompt_set(
+	minirl_state_st * const l,
+	char const * const prompt,
+	size_t const prompt_len)
+{
+	l->prompt = prompt;
+	l->prompt_len = prompt_len;
+	l->prompt_ascii = non_ascii_count(prompt, prompt_len) == 0;
+	minirl_state_prompt_measure(l);
+}
+
 static void
 calculate_cursor_position(
     minirl_state_st * const l,
@@ -329,18 +635,23 @@ calculate_cursor_position(
     size_t const point,
     internal_line_buffer_st const * const internal)
 {
-	*cursor = (cursor_st){ 0 };
+	if (l->prompt_end_width != l->terminal_width) {
+		/* The terminal has been resized. */
+		minirl_state_prompt_measure(l);
+	}
+	*cursor = l->prompt_end;
 
-	string_wrap(l->prompt, l->prompt_len, l->terminal_width, cursor);
 	if (internal != NULL) {
-		string_wrap(internal->buffer, point, l->terminal_width, cursor);
+		string_wrap(internal->buffer, point, internal->ascii,
+			l->terminal_width, cursor);
+
+		size_t const next_width = (point >= internal->end) ? 0
+			: internal->ascii
+			? ascii_grapheme_width(internal->buffer, internal->end, point, NULL)
+			: grapheme_width(internal->buffer, internal->end, point, NULL);
 
 		if (cursor->col == l->terminal_width
-		    || (point < internal->end
-			&& cursor->col + grapheme_width(internal->buffer,
-							internal->end,
-							point,
-							NULL) > l->terminal_width)) {
+		    || cursor->col + next_width > l->terminal_width) {
 			/*
 			 * At EOL or the next character is too wide, so
 			 * move to the next line.
@@ -406,6 +717,168 @@ emit_set_column(struct buffer * const ab, size_t const column_num)
 	}
 }
 
+static void
+emit_prompt(struct buffer * const ab, char const * const prompt, size_t const len)
+{
+	/* Leave out any markers of text that takes no room. */
+	size_t start = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (prompt[i] == PROMPT_START_IGNORE || prompt[i] == PROMPT_END_IGNORE) {
+			buffer_append(ab, prompt + start, i - start);
+			start = i + 1;
+		}
+	}
+	buffer_append(ab, prompt + start, len - start);
+}
+
+static void
+emit_suggestion(
+	struct buffer * const ab,
+	char const * const suggestion,
+	size_t const width)
+{
+	/* Show the suggestion dimmed, leaving the cursor where it was. */
+	char const dim[] = ESCAPESTR "[2m";
+	char const normal[] = ESCAPESTR "[0m";
+
+	buffer_append(ab, dim, strlen(dim));
+	buffer_append(ab, suggestion, strlen(suggestion));
+	buffer_append(ab, normal, strlen(normal));
+	if (width > 0) {
+		/* A count of 0 would still move the cursor one column. */
+		emit_cursor_left(ab, width);
+	}
+}
+
+static bool
+history_suggestion_extends(
+	history_suggestion_st const * const suggestion,
+	minirl_state_st const * const l)
+{
+	return suggestion->line.len > l->len
+		&& memcmp(suggestion->line.b, l->line_buf->b, l->len) == 0;
+}
+
+/*
+ * Find the newest history entry that extends the line.
+ * Returns true if the suggestion is unchanged, in which case the text just
+ * added to the line matches the start of what is already displayed.
+ */
+static bool
+history_suggestion_update(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	history_suggestion_st * const suggestion = &minirl->suggestion;
+
+	if (!suggestion->enabled || minirl->options.echo.disable || l->search.active) {
+		suggestion->valid = false;
+		return false;
+	}
+
+	uint64_t id = HISTORY_ID_EDIT_LINE;
+
+	/*
+	 * If the line still starts with the text it held when the suggestion
+	 * was found, then no newer entry can extend it, so carry on from the
+	 * suggestion.
+	 */
+	if (suggestion->valid
+	    && l->len >= suggestion->prefix_len
+	    && memcmp(suggestion->line.b, l->line_buf->b, suggestion->prefix_len) == 0) {
+		id = suggestion->id;
+		if (id != 0 && history_suggestion_extends(suggestion, l)) {
+			suggestion->prefix_len = l->len;
+			return true;
+		}
+	} else {
+		history_sync(minirl->history);
+	}
+
+	while (id != 0) {
+		id = history_read(minirl->history, id, true, &suggestion->line);
+		if (id != 0 && history_suggestion_extends(suggestion, l)) {
+			break;
+		}
+	}
+
+	if (id == 0) {
+		/* Nothing extends the line, so just remember the line. */
+		suggestion->line.len = 0;
+		if (!buffer_append(&suggestion->line, l->line_buf->b, l->len)) {
+			suggestion->valid = false;
+			return false;
+		}
+	}
+	suggestion->valid = true;
+	suggestion->id = id;
+	suggestion->prefix_len = l->len;
+
+	return false;
+}
+
+/*
+ * Check that the text of a suggestion can be written out as it is. It comes
+ * from the history, so may hold invalid characters or control characters,
+ * such as ESC, that would move the cursor or start an escape sequence.
+ */
+static bool
+history_suggestion_printable(char const * const s, size_t const len)
+{
+	if (char_valid_run(s, len, 0) != len) {
+		return false;
+	}
+	for (size_t point = 0; point < len;) {
+		size_t const next = char_next(s, len, point);
+		uint32_t c = (unsigned char)s[point];
+
+		if (next - point > 1) {
+			char_decode(s + point, next - point, &c);
+		}
+		/* The C0 controls, DEL and the C1 controls. */
+		if (c < FIRST_PRINTABLE_ASCII || (c >= MAX_ASCII && c < 0xa0)) {
+			return false;
+		}
+		point = next;
+	}
+
+	return true;
+}
+
+/*
+ * Get the part of the suggestion that would follow the end of the line, and
+ * its width, or NULL if there's nothing that can be shown.
+ */
+static char const *
+history_suggestion_get(minirl_st * const minirl, size_t * const width)
+{
+	minirl_state_st const * const l = &minirl->state;
+	history_suggestion_st const * const suggestion = &minirl->suggestion;
+
+	if (!suggestion->valid
+	    || suggestion->id == 0
+	    || suggestion->prefix_len != l->len
+	    || l->len == 0
+	    || l->pos != l->len
+	    || !history_suggestion_extends(suggestion, l)) {
+		return NULL;
+	}
+
+	char const * const s = suggestion->line.b + l->len;
+	size_t const len = suggestion->line.len - l->len;
+
+	if (!history_suggestion_printable(s, len)) {
+		return NULL;
+	}
+
+	*width = 0;
+	for (size_t point = 0; point < len;) {
+		*width += grapheme_width(s, len, point, &point);
+	}
+
+	return (*width > 0) ? s : NULL;
+}
+
 static bool
 minirl_refresh_cursor(minirl_st * const minirl)
 {
@@ -535,7 +1008,7 @@ minirl_refresh_line(minirl_st * const minirl)
 	emit_row_clear(&ab);
 
 	/* Write the prompt and the current buffer content */
-	buffer_append(&ab, l->prompt, strlen(l->prompt));
+	emit_prompt(&ab, l->prompt, l->prompt_len);
 	buffer_append(&ab, internal.buffer, internal.end);
 
 	/*
@@ -551,6 +1024,15 @@ minirl_refresh_line(minirl_st * const minirl)
 		buffer_append(&ab, "\n\r", strlen("\n\r"));
 	}
 
+	size_t suggestion_width;
+	char const * const suggestion = history_suggestion_get(minirl, &suggestion_width);
+
+	minirl->suggestion.shown = suggestion != NULL
+		&& line_end_cursor.col + suggestion_width < l->terminal_width;
+	if (minirl->suggestion.shown) {
+		emit_suggestion(&ab, suggestion, suggestion_width);
+	}
+
 	/*
 	 * Move cursor to right position. At present it will be at the end of the
 	 * current line.
@@ -631,10 +1113,14 @@ minirl_edit_insert(
 	l->len += len;
 	l->pos += len;
 	l->line_buf->b[l->len] = '\0';
+	l->non_ascii += non_ascii_count(text, len);
 
 	bool require_full_refresh = true;
+	bool suggestion_unchanged = false;
 
 	if (l->len == l->pos) { /* Editing at the end of the line. */
+		suggestion_unchanged = history_suggestion_update(minirl);
+
 		cursor_st const old_line_end = l->previous_cursor;
 		cursor_st new_line_end;
 		internal_line_buffer_st internal;
@@ -676,7 +1162,35 @@ minirl_edit_insert(
 	if (require_full_refresh) {
 		minirl_state_refresh_required(l);
 	} else if (!minirl->options.echo.disable) {
-		if (io_write(minirl->out.fd, text, len) == -1) {
+		struct buffer ab;
+
+		buffer_init(&ab, len);
+		buffer_append(&ab, text, len);
+		/*
+		 * Typing the start of the suggestion being shown overwrites it,
+		 * leaving the rest as it is. Otherwise replace it.
+		 */
+		if (!suggestion_unchanged || !minirl->suggestion.shown) {
+			size_t suggestion_width;
+			char const * const suggestion =
+				history_suggestion_get(minirl, &suggestion_width);
+
+			if (minirl->suggestion.shown) {
+				char const clear[] = ESCAPESTR "[0K";
+
+				buffer_append(&ab, clear, strlen(clear));
+			}
+			minirl->suggestion.shown = suggestion != NULL
+				&& l->previous_line_end.col + suggestion_width < l->terminal_width;
+			if (minirl->suggestion.shown) {
+				emit_suggestion(&ab, suggestion, suggestion_width);
+			}
+		}
+
+		ssize_t const res = io_write(minirl->out.fd, ab.b, ab.len);
+
+		buffer_clear(&ab);
+		if (res == -1) {
 			minirl_state_had_error(l);
 			return -1;
 		}
@@ -702,42 +1216,116 @@ enum minirl_history_direction
 	minirl_HISTORY_PREV = 1
 };
 
-static bool
-minirl_edit_history_next(minirl_st * const minirl, enum minirl_history_direction const dir)
+static history_edit_st *
+history_edit_find(minirl_state_st const * const l, uint64_t const id)
 {
-	minirl_state_st * const l = &minirl->state;
-
-	if (minirl->history.current_len > 1) {
-		/*
-		 * Update the current history entry before to
-		 * overwrite it with the next one.
-		 */
-		free(minirl->history.history[minirl->history.current_len - 1 - l->history_index]);
-		minirl->history.history[minirl->history.current_len - 1 - l->history_index] = strdup(l->line_buf->b);
-		/* Show the new entry */
-		l->history_index += (dir == minirl_HISTORY_PREV) ? 1 : -1;
-		if (l->history_index < 0) {
-			l->history_index = 0;
-			return false;
-		} else if (l->history_index >= minirl->history.current_len) {
-			l->history_index = minirl->history.current_len - 1;
-			return false;
+	for (history_edit_st *edit = l->history_edits; edit != NULL; edit = edit->next) {
+		if (edit->id == id) {
+			return edit;
 		}
-		buffer_clear(l->line_buf);
-		buffer_init(l->line_buf,
-			    strlen(minirl->history.history[minirl->history.current_len - 1 - l->history_index]));
-		buffer_append(l->line_buf,
-			      minirl->history.history[minirl->history.current_len - 1 - l->history_index],
-			      strlen(minirl->history.history[minirl->history.current_len - 1 - l->history_index]));
-		l->len = l->pos = l->line_buf->len;
-		return true;
 	}
-	return false;
+
+	return NULL;
 }
 
-static void
-delete_text(minirl_state_st * const l, size_t const start, size_t const end)
-{
+/*
+ * Remember the current line as the edited version of the history entry
+ * being edited, so that the edits are kept while browsing the history.
+ * The history itself is left unchanged.
+ */
+static bool
+history_edit_save(minirl_state_st * const l)
+{
+	history_edit_st *edit = history_edit_find(l, l->history_id);
+	char * const line = strdup(l->line_buf->b);
+
+	if (line == NULL) {
+		return false;
+	}
+	if (edit == NULL) {
+		edit = malloc(sizeof(*edit));
+		if (edit == NULL) {
+			free(line);
+			return false;
+		}
+		edit->id = l->history_id;
+		edit->next = l->history_edits;
+		l->history_edits = edit;
+	} else {
+		free(edit->line);
+	}
+	edit->line = line;
+
+	return true;
+}
+
+static void
+history_edits_free(minirl_state_st * const l)
+{
+	while (l->history_edits != NULL) {
+		history_edit_st * const edit = l->history_edits;
+
+		l->history_edits = edit->next;
+		free(edit->line);
+		free(edit);
+	}
+}
+
+static bool
+minirl_edit_history_next(minirl_st * const minirl, enum minirl_history_direction const dir)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer entry;
+
+	if (!buffer_init(&entry, 0)) {
+		return false;
+	}
+
+	/* Pick up any lines added by other processes. */
+	history_sync(minirl->history);
+
+	uint64_t id = history_read(minirl->history,
+				   l->history_id,
+				   dir == minirl_HISTORY_PREV,
+				   &entry);
+
+	if (id == 0 && dir == minirl_HISTORY_NEXT
+	    && l->history_id != HISTORY_ID_EDIT_LINE) {
+		/* Moved on from the newest entry, back to the line being edited. */
+		id = HISTORY_ID_EDIT_LINE;
+	}
+
+	/*
+	 * Save the current entry before overwriting it with the next one.
+	 * Show the edited version of the new entry if it has been edited.
+	 */
+	if (id == 0 || !history_edit_save(l)) {
+		buffer_clear(&entry);
+		return false;
+	}
+
+	history_edit_st const * const edit = history_edit_find(l, id);
+
+	if (edit != NULL) {
+		entry.len = 0;
+		if (!buffer_append(&entry, edit->line, strlen(edit->line))) {
+			buffer_clear(&entry);
+			return false;
+		}
+	}
+
+	buffer_clear(l->line_buf);
+	*l->line_buf = entry;
+	l->history_id = id;
+	l->len = l->pos = l->line_buf->len;
+	minirl_state_line_recount(l);
+
+	return true;
+}
+
+static void
+delete_text(minirl_state_st * const l, size_t const start, size_t const end)
+{
 	if (end == start) {
 		return;
 	}
@@ -745,6 +1333,7 @@ delete_text(minirl_state_st * const l, size_t const start, size_t const end)
 	/* Move any text which is left, including terminator. */
 	size_t const delta = end - start;
 
+	minirl_state_line_removing(l, start, end);
 	memmove(&l->line_buf->b[start],
 			&l->line_buf->b[start + delta],
 			l->len + 1 - end);
@@ -770,7 +1359,7 @@ static bool
 delete_char_right(minirl_state_st * const l)
 {
 	if (l->len > 0 && l->pos < l->len) {
-		size_t const end = grapheme_next(l->line_buf->b, l->len, l->pos);
+		size_t const end = line_grapheme_next(l, l->pos);
 
 		delete_text(l, l->pos, end);
 
@@ -786,7 +1375,7 @@ delete_char_left(minirl_state_st * const l)
 	if (l->pos > 0 && l->len > 0) {
 		size_t const end = l->pos;
 
-		l->pos = grapheme_prev(l->line_buf->b, l->len, l->pos);
+		l->pos = line_grapheme_prev(l, l->pos);
 		delete_text(l, l->pos, end);
 
 		return true;
@@ -815,26 +1404,48 @@ delete_all_chars_left(minirl_state_st * const l)
 static void
 minirl_edit_delete_prev_word(minirl_state_st * const l)
 {
-	size_t old_pos = l->pos;
+	size_t const start = line_word_prev(l, l->pos);
 
-	while (l->pos > 0 && l->line_buf->b[l->pos - 1] == ' ') {
-		l->pos--;
-	}
-	while (l->pos > 0 && l->line_buf->b[l->pos - 1] != ' ') {
-		l->pos--;
+	if (start != l->pos) {
+		delete_text(l, start, l->pos);
+		minirl_state_refresh_required(l);
 	}
+}
 
-	size_t const diff = old_pos - l->pos;
+/* Delete up to the end of the next word, leaving the cursor where it is. */
+static void
+minirl_edit_delete_next_word(minirl_state_st * const l)
+{
+	size_t const end = line_word_next(l, l->pos);
 
-	if (diff != 0) {
-		memmove(l->line_buf->b + l->pos,
-			l->line_buf->b + old_pos,
-			l->len - old_pos + 1);
-		l->len -= diff;
+	if (end != l->pos) {
+		delete_text(l, l->pos, end);
 		minirl_state_refresh_required(l);
 	}
 }
 
+static void
+move_edit_position_word_left(minirl_state_st * const l)
+{
+	size_t const start = line_word_prev(l, l->pos);
+
+	if (start != l->pos) {
+		l->pos = start;
+		minirl_state_cursor_refresh_required(l);
+	}
+}
+
+static void
+move_edit_position_word_right(minirl_state_st * const l)
+{
+	size_t const end = line_word_next(l, l->pos);
+
+	if (end != l->pos) {
+		l->pos = end;
+		minirl_state_cursor_refresh_required(l);
+	}
+}
+
 static bool
 delete_whole_line(minirl_state_st * const l)
 {
@@ -842,6 +1453,7 @@ delete_whole_line(minirl_state_st * const l)
 		l->line_buf->b[0] = '\0';
 		l->pos = 0;
 		l->len = 0;
+		l->non_ascii = 0;
 
 		return true;
 	}
@@ -853,9 +1465,9 @@ static bool
 swap_chars_at_cursor(minirl_state_st * const l)
 {
 	if (l->pos > 0 && l->pos < l->len) {
-		size_t const prev = grapheme_prev(l->line_buf->b, l->len, l->pos);
+		size_t const prev = line_grapheme_prev(l, l->pos);
 		size_t const prev_len = l->pos - prev;
-		size_t const next = grapheme_next(l->line_buf->b, l->len, l->pos);
+		size_t const next = line_grapheme_next(l, l->pos);
 		size_t const next_len = next - l->pos;
 		char * const temp_buf = malloc(prev_len + next_len);
 
@@ -876,7 +1488,7 @@ swap_chars_at_cursor(minirl_state_st * const l)
 		 * Now move the edit position along unless that would mean
 		 * another swap command wouldn't do anything.
 		 */
-		if (grapheme_next(l->line_buf->b, l->len, l->pos) < l->len) {
+		if (line_grapheme_next(l, l->pos) < l->len) {
 			l->pos = next;
 		}
 		return true;
@@ -890,6 +1502,7 @@ static bool
 delete_from_cursor_to_eol(minirl_state_st * const l)
 {
 	if (l->pos != l->len) {
+		minirl_state_line_removing(l, l->pos, l->len);
 		l->line_buf->b[l->pos] = '\0';
 		l->len = l->pos;
 
@@ -899,26 +1512,21 @@ delete_from_cursor_to_eol(minirl_state_st * const l)
 	return false;
 }
 
-static void
-remove_current_line_from_history(minirl_st * const minirl)
-{
-	if (minirl->history.current_len == 0) {
-		/* Shouldn't happen. assert instead? */
-		return;
-	}
-	minirl->history.current_len--;
-	free(minirl->history.history[minirl->history.current_len]);
-	minirl->history.history[minirl->history.current_len] = NULL;
-}
-
 static void
 minirl_edit_done(minirl_st * const minirl)
 {
-	remove_current_line_from_history(minirl);
 	move_edit_position_to_end(&minirl->state);
 	if (minirl->state.flags.cursor_refresh_required) {
 		minirl_refresh_cursor(minirl);
 	}
+	if (minirl->suggestion.shown) {
+		/* Remove the suggestion from the accepted line. */
+		char const clear[] = ESCAPESTR "[0K";
+		int const res = io_write(minirl->out.fd, clear, strlen(clear));
+
+		(void)res;
+		minirl->suggestion.shown = false;
+	}
 }
 
 static bool
@@ -966,10 +1574,36 @@ down_handler(minirl_st * const minirl, char const * const key, void * const user
 	return true;
 }
 
+/* Add the rest of the suggestion to the line, if one is shown. */
+static bool
+history_suggestion_accept(minirl_st * const minirl)
+{
+	size_t width;
+	char const * const suggestion = history_suggestion_get(minirl, &width);
+
+	if (suggestion == NULL || !minirl->suggestion.shown) {
+		return false;
+	}
+
+	/* Inserting the text updates the suggestion, so take a copy first. */
+	char * const text = strdup(suggestion);
+
+	if (text == NULL) {
+		minirl_state_had_error(&minirl->state);
+		return true;
+	}
+	minirl_text_insert(minirl, text);
+	free(text);
+
+	return true;
+}
+
 static bool
 right_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 {
-	move_edit_position_right(&minirl->state);
+	if (!history_suggestion_accept(minirl)) {
+		move_edit_position_right(&minirl->state);
+	}
 
 	return true;
 }
@@ -993,6 +1627,9 @@ home_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 static bool
 end_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 {
+	if (history_suggestion_accept(minirl)) {
+		return true;
+	}
 	move_edit_position_to_end(&minirl->state);
 
 	return true;
@@ -1051,7 +1688,6 @@ ctrl_d_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 		result = delete_handler(minirl, key, user_ctx);
 	} else {
 		/* Line is empty, so indicate an error. */
-		remove_current_line_from_history(minirl);
 		minirl_state_had_error(l);
 		result = true;
 	}
@@ -1119,53 +1755,413 @@ ctrl_w_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 	return true;
 }
 
+static bool
+alt_b_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Move to the start of the previous word. */
+	move_edit_position_word_left(&minirl->state);
+
+	return true;
+}
+
+static bool
+alt_f_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Move to the end of the next word. */
+	move_edit_position_word_right(&minirl->state);
+
+	return true;
+}
+
+static bool
+alt_d_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Delete the next word. */
+	minirl_edit_delete_next_word(&minirl->state);
+
+	return true;
+}
+
+static bool
+minirl_state_line_set(minirl_state_st * const l, char const * const line)
+{
+	l->line_buf->len = 0;
+	if (!buffer_append(l->line_buf, line, strlen(line))) {
+		minirl_state_had_error(l);
+		return false;
+	}
+	l->len = l->pos = l->line_buf->len;
+	minirl_state_line_recount(l);
+	minirl_state_refresh_required(l);
+
+	return true;
+}
+
+/*
+ * Show the line ranked 'search.match' among those starting with the search
+ * query, falling back to the lowest ranked line if there are fewer matches.
+ */
+static void
+history_search_update(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	history_search_st * const search = &l->search;
+	char ** const matches = history_top(minirl->history,
+					    search->query.b,
+					    search->match + 1,
+					    minirl->options.fuzzy);
+	size_t count = 0;
+
+	if (matches == NULL) {
+		minirl_state_had_error(l);
+		return;
+	}
+	while (matches[count] != NULL) {
+		count++;
+	}
+	if (count > 0) {
+		if (search->match >= count) {
+			search->match = count - 1;
+		}
+		minirl_state_line_set(l, matches[search->match]);
+	}
+	free(matches);
+
+	char const * const status = (count > 0) ? "history" : "failed history";
+
+	search->prompt.len = 0;
+	buffer_append(&search->prompt, "(", 1);
+	buffer_append(&search->prompt, status, strlen(status));
+	buffer_append(&search->prompt, ")`", 2);
+	buffer_append(&search->prompt, search->query.b, search->query.len);
+	buffer_append(&search->prompt, "': ", 3);
+	minirl_state_prompt_set(l, search->prompt.b, search->prompt.len);
+	minirl_state_refresh_required(l);
+}
+
+static void
+history_search_start(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	history_search_st * const search = &l->search;
+
+	search->saved_line = strdup(l->line_buf->b);
+	if (search->saved_line == NULL
+	    || !buffer_init(&search->query, 0)
+	    || !buffer_init(&search->prompt, 0)) {
+		free(search->saved_line);
+		buffer_clear(&search->query);
+		minirl_state_had_error(l);
+		return;
+	}
+	search->query.b[0] = '\0';
+	search->active = true;
+	search->match = 0;
+	search->saved_prompt = l->prompt;
+	search->saved_keymap = minirl->keymap;
+	minirl->keymap = minirl->search_keymap;
+
+	history_search_update(minirl);
+}
+
+static void
+history_search_end(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	history_search_st * const search = &l->search;
+
+	if (!search->active) {
+		return;
+	}
+	search->active = false;
+	minirl->keymap = search->saved_keymap;
+	minirl_state_prompt_set(l, search->saved_prompt,
+		strlen(search->saved_prompt));
+	l->pos = l->len;
+	free(search->saved_line);
+	buffer_clear(&search->query);
+	buffer_clear(&search->prompt);
+	minirl_state_refresh_required(l);
+}
+
+static bool
+ctrl_r_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Start an incremental search of the history, best ranked first. */
+	history_search_start(minirl);
+
+	return true;
+}
+
+static bool
+search_char_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Add the key to the search query. */
+	history_search_st * const search = &minirl->state.search;
+
+	if (!buffer_append(&search->query, key, strlen(key))) {
+		minirl_state_had_error(&minirl->state);
+		return true;
+	}
+	search->match = 0;
+	history_search_update(minirl);
+
+	return true;
+}
+
+static bool
+search_backspace_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Remove the last character from the search query. */
+	history_search_st * const search = &minirl->state.search;
+
+	if (search->query.len > 0) {
+		search->query.len = grapheme_prev(search->query.b,
+						  search->query.len,
+						  search->query.len);
+		search->query.b[search->query.len] = '\0';
+		search->match = 0;
+		history_search_update(minirl);
+	}
+
+	return true;
+}
+
+static bool
+search_next_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Show the next best ranked matching line. */
+	minirl->state.search.match++;
+	history_search_update(minirl);
+
+	return true;
+}
+
+static bool
+search_cancel_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Restore the line as it was before searching. */
+	minirl_state_st * const l = &minirl->state;
+
+	minirl_state_line_set(l, l->search.saved_line);
+	history_search_end(minirl);
+
+	return true;
+}
+
+static bool
+search_exit_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Stop searching and edit the matching line. */
+	history_search_end(minirl);
+
+	return true;
+}
+
+static bool
+search_accept_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	history_search_end(minirl);
+	minirl_is_done(minirl);
+
+	return true;
+}
+
+static minirl_keymap_st *
+search_keymap_new(minirl_st * const minirl)
+{
+	/* The search keymap is bound while it is active, so save the current one. */
+	minirl_keymap_st * const keymap = minirl->keymap;
+
+	minirl->keymap = minirl_keymap_new();
+	if (minirl->keymap == NULL) {
+		minirl->keymap = keymap;
+		return NULL;
+	}
+
+	for (size_t i = 32; i < 256; i++) {
+		minirl_bind_key(minirl, i, search_char_handler, NULL);
+	}
+
+	minirl_bind_key(minirl, CTRL('a'), search_exit_handler, NULL);
+	minirl_bind_key(minirl, CTRL('c'), search_cancel_handler, NULL);
+	minirl_bind_key(minirl, CTRL('e'), search_exit_handler, NULL);
+	minirl_bind_key(minirl, CTRL('g'), search_cancel_handler, NULL);
+	minirl_bind_key(minirl, CTRL('h'), search_backspace_handler, NULL);
+	minirl_bind_key(minirl, CTRL('r'), search_next_handler, NULL);
+
+	minirl_bind_key(minirl, ENTER, search_accept_handler, NULL);
+	minirl_bind_key(minirl, BACKSPACE, search_backspace_handler, NULL);
+
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[A", search_exit_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[B", search_exit_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[C", search_exit_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[D", search_exit_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[H", search_exit_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "[F", search_exit_handler, NULL);
+
+	minirl_keymap_st * const search_keymap = minirl->keymap;
+
+	minirl->keymap = keymap;
+
+	return search_keymap;
+}
+
 typedef struct char_st {
 	int len;
 	char bytes[MAX_CHAR_LEN + 1];
 } char_st;
 
+/* Whether the byte 'c' is simply inserted into the line when typed. */
+static bool
+input_is_text(minirl_st const * const minirl, char const c)
+{
+	key_handler_st const * const key = &minirl->keymap->keys[(uint8_t)c];
+
+	return key->handler == default_handler && key->keymap == NULL;
+}
+
+/* Get the number of bytes waiting to be read from the input. */
+static size_t
+input_pending(minirl_st const * const minirl)
+{
+	int pending;
+
+	if (ioctl(minirl->in.fd, FIONREAD, &pending) == -1 || pending < 0) {
+		return 0;
+	}
+
+	return pending;
+}
+
+/*
+ * Read a key, and then any text already waiting after it, a byte at a time,
+ * so that nothing after a key that may end the line is taken from the input.
+ */
+static bool
+input_fill_exact(minirl_st * const minirl)
+{
+	input_buffer_st * const input = &minirl->in.buffer;
+
+	if (io_read(minirl->in.fd, input->bytes, 1) != 1) {
+		return false;
+	}
+	input->start = 0;
+	input->end = 1;
+
+	size_t pending = 0;
+
+	while (input->end < sizeof(input->bytes)
+	       && input_is_text(minirl, input->bytes[input->end - 1])) {
+		if (pending == 0) {
+			pending = input_pending(minirl);
+			if (pending == 0) {
+				break;
+			}
+		}
+		if (io_read(minirl->in.fd, input->bytes + input->end, 1) != 1) {
+			break;
+		}
+		input->end++;
+		pending--;
+	}
+
+	return true;
+}
+
+/*
+ * Make sure there's input to be read, reading whatever is available if none
+ * is left. Returns false on error or at the end of the input.
+ * Anything read after the key that ends the line is kept for the next line.
+ */
+static bool
+input_fill(minirl_st * const minirl)
+{
+	input_buffer_st * const input = &minirl->in.buffer;
+
+	if (input->start < input->end) {
+		return true;
+	}
+	if (minirl->options.exact_input) {
+		return input_fill_exact(minirl);
+	}
+
+	ssize_t const nread = io_read(minirl->in.fd, input->bytes, sizeof(input->bytes));
+
+	if (nread <= 0) {
+		return false;
+	}
+	input->start = 0;
+	input->end = nread;
+
+	return true;
+}
+
 static char_st
-char_read(int const fd)
+char_read(minirl_st * const minirl)
 {
 	/*
 	 * Read either an ASCII or UTF-8 char from the input stream, depending on
 	 * whether UTF-8 support is included.
+	 * An invalid char is read as CHAR_REPLACEMENT, leaving unread any byte
+	 * that can't be part of it.
 	 */
+	input_buffer_st * const input = &minirl->in.buffer;
 	char_st ch = { 0 };
-	int nread;
 
-	nread = io_read(fd, &ch.bytes[0], sizeof(ch.bytes[ch.len]));
-	if (nread <= 0) {
+	if (!input_fill(minirl)) {
 		ch.len = -1;
 		goto done;
 	}
-
+	ch.bytes[0] = input->bytes[input->start++];
 	ch.len = char_len(ch.bytes[0]);
-	if (ch.len == 0 || ch.len > MAX_CHAR_LEN) {
-		ch.len = -1;
-		goto done;
-	}
 
 	/* Read the rest of the bytes making up this char (will be 0 for ASCII). */
 	for (int i = 1; i < ch.len; i++) {
-		nread = io_read(fd, &ch.bytes[i], 1);
-		if (nread <= 0) {
+		if (!input_fill(minirl)) {
 			ch.len = -1;
 			goto done;
 		}
+		/* Stop at a byte that isn't a continuation byte. */
+		if ((input->bytes[input->start] & 0xc0) != 0x80) {
+			ch.len = i;
+			break;
+		}
+		ch.bytes[i] = input->bytes[input->start++];
 	}
-	ch.bytes[ch.len] = '\0';
 
-	bool const is_valid_char = char_decode(ch.bytes, ch.len, NULL) == ch.len;
+	bool const is_valid_char = ch.len > 0 && char_decode(ch.bytes, ch.len, NULL) == ch.len;
 	if (!is_valid_char) {
-		ch.len = -1;
-		goto done;
+		ch.len = strlen(CHAR_REPLACEMENT);
+		memcpy(ch.bytes, CHAR_REPLACEMENT, ch.len);
 	}
+	ch.bytes[ch.len] = '\0';
 
 done:
 	return ch;
 }
 
+/*
+ * Get the length of the text at the start of the input that can be
+ * inserted into the line as it is, i.e. the valid chars up to the first
+ * that's bound to something other than the default handler. This lets
+ * pasted text be inserted in one go rather than a key at a time.
+ */
+static size_t
+input_text_len(minirl_st const * const minirl)
+{
+	input_buffer_st const * const input = &minirl->in.buffer;
+	char const * const text = input->bytes + input->start;
+	size_t const valid_len = char_valid_run(text, input->end - input->start, 0);
+	size_t len = 0;
+
+	while (len < valid_len && input_is_text(minirl, text[len])) {
+		len += char_len(text[len]);
+	}
+
+	return len;
+}
+
 static void
 key_handler_lookup(
 	minirl_st * const minirl,
@@ -1200,7 +2196,7 @@ key_handler_lookup(
 		i++;
 		if (i >= ch->len) {
 			/* Get here with multi-byte sequences. */
-			char_st new_ch = char_read(minirl->in.fd);
+			char_st new_ch = char_read(minirl);
 
 			if (new_ch.len <= 0) {
 				break;
@@ -1211,6 +2207,85 @@ key_handler_lookup(
 	}
 }
 
+/*
+ * Update the terminal to reflect the changes made to the line by a key
+ * handler or a completion.
+ * Returns 1 once editing is done, -1 on error, or 0 otherwise.
+ */
+static int
+minirl_edit_update(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+
+	if (l->flags.error) {
+		return -1;
+	}
+
+	if (!l->flags.done
+	    && !l->flags.refresh_required
+	    && l->flags.cursor_refresh_required) {
+		minirl_refresh_cursor(minirl);
+	}
+	if (l->flags.refresh_required) {
+		/*
+		 * Text added at the end of the line updates the suggestion as
+		 * it's inserted, but removing text from it, e.g. with Backspace
+		 * or Ctrl-W, may also leave a line that something extends.
+		 */
+		if (!l->flags.done && l->flags.text_removed && l->pos == l->len) {
+			history_suggestion_update(minirl);
+		}
+		minirl_refresh_line(minirl);
+	}
+
+	if (l->flags.done) {
+		minirl_edit_done(minirl);
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Wait for input, applying any completions that arrive in the meantime.
+ * Returns the same as minirl_edit_update().
+ */
+static int
+minirl_edit_wait(minirl_st * const minirl)
+{
+	int const event_fd = complete_async_fd(minirl);
+
+	if (event_fd == -1 || minirl->in.buffer.start < minirl->in.buffer.end) {
+		/* Nothing else to wait for, or input already read, so just read it. */
+		return 0;
+	}
+
+	for (;;) {
+		struct pollfd fds[] = {
+			{ .fd = minirl->in.fd, .events = POLLIN },
+			{ .fd = event_fd, .events = POLLIN }
+		};
+
+		if (TEMP_FAILURE_RETRY(poll(fds, ARRAY_SIZE(fds), -1)) == -1) {
+			return -1;
+		}
+
+		if ((fds[1].revents & POLLIN) != 0) {
+			minirl->state.flags = (minirl_key_handler_flags_st){0};
+			complete_async_apply(minirl);
+
+			int const res = minirl_edit_update(minirl);
+
+			if (res != 0) {
+				return res;
+			}
+		}
+		if (fds[0].revents != 0) {
+			return 0;
+		}
+	}
+}
+
 /*
  * This function is the core of the line editing capability of minirl.
  * It expects 'fd' to be already in "raw mode" so that every key pressed
@@ -1230,13 +2305,20 @@ static int minirl_edit(
 
 	/* Populate the minirl state implementing editing functionalities. */
 	l->line_buf = line_buf;
-	l->prompt = prompt;
-	l->prompt_len = strlen(prompt);
 	l->pos = 0;
 	l->len = 0;
+	l->non_ascii = 0;
 	l->terminal_width = minirl_terminal_width(minirl);
+	/* The prompt is measured once, unless the terminal is resized. */
+	minirl_state_prompt_set(l, prompt, strlen(prompt));
 	l->max_rows = 1;
-	l->history_index = 0;
+	l->history_id = HISTORY_ID_EDIT_LINE;
+	minirl->suggestion.valid = false;
+	minirl->suggestion.shown = false;
+	/* Any completions still to arrive were for an earlier line. */
+	complete_async_cancel(minirl);
+	complete_cache_clear(&minirl->complete_cache);
+	complete_menu_clear(&minirl->complete_menu);
 
 	/* Buffer starts empty. */
 	l->line_buf->b[0] = '\0';
@@ -1248,51 +2330,60 @@ static int minirl_edit(
 	calculate_cursor_position(l, &l->previous_cursor, 0, NULL);
 	l->previous_line_end = l->previous_cursor;
 
-	/*
-	 * The latest history entry is always our current buffer, that
-	 * initially is just an empty string.
-	 */
-	minirl_history_add(minirl, "");
-
 	/* Get the prompt printed by refreshing the empty line. */
 	minirl_refresh_line(minirl);
 
 	for (;;) {
-		char_st ch = char_read(minirl->in.fd);
+		int const wait_res = minirl_edit_wait(minirl);
+
+		if (wait_res == -1) {
+			return -1;
+		}
+		if (wait_res == 1) {
+			break;
+		}
 
-		if (ch.len <= 0) {
+		if (!input_fill(minirl)) {
 			return -1;
 		}
 
-		minirl_key_binding_handler_cb handler = NULL;
-		void *user_ctx = NULL;
+		size_t const text_len = input_text_len(minirl);
 
-		key_handler_lookup(minirl, &ch, &handler, &user_ctx);
+		if (text_len > 0) {
+			input_buffer_st * const input = &minirl->in.buffer;
 
-		if (handler != NULL) {
 			l->flags = (minirl_key_handler_flags_st){0};
+			minirl_text_len_insert(minirl, input->bytes + input->start, text_len);
+			input->start += text_len;
+		} else {
+			char_st ch = char_read(minirl);
 
-			/* TODO: Should pass the complete key sequence. */
-			bool const res = handler(minirl, ch.bytes, user_ctx);
-			(void)res; //* TODO: Treat false as an error?
-
-			if (l->flags.error) {
+			if (ch.len <= 0) {
 				return -1;
 			}
 
-			if (!l->flags.done
-			    && !l->flags.refresh_required
-			    && l->flags.cursor_refresh_required) {
-				minirl_refresh_cursor(minirl);
-			}
-			if (l->flags.refresh_required) {
-				minirl_refresh_line(minirl);
-			}
+			minirl_key_binding_handler_cb handler = NULL;
+			void *user_ctx = NULL;
 
-			if (l->flags.done) {
-				minirl_edit_done(minirl);
-				break;
+			key_handler_lookup(minirl, &ch, &handler, &user_ctx);
+
+			if (handler == NULL) {
+				continue;
 			}
+			l->flags = (minirl_key_handler_flags_st){0};
+
+			/* TODO: Should pass the complete key sequence. */
+			bool const res = handler(minirl, ch.bytes, user_ctx);
+			(void)res; //* TODO: Treat false as an error?
+		}
+
+		int const update_res = minirl_edit_update(minirl);
+
+		if (update_res == -1) {
+			return -1;
+		}
+		if (update_res == 1) {
+			break;
 		}
 	}
 
@@ -1315,11 +2406,55 @@ minirl_raw(
 
 	int const count = minirl_edit(minirl, line_buf, prompt);
 
+	history_search_end(minirl);
+	complete_pager_end(minirl);
+	history_edits_free(&minirl->state);
 	disable_raw_mode(minirl, minirl->in.fd);
 
 	return count;
 }
 
+/*
+ * Replace any invalid chars in 'line', of length 'len', with
+ * CHAR_REPLACEMENT. Returns 'line' if it's all valid, or else a corrected
+ * copy, freeing 'line'.
+ */
+static char *
+line_replace_invalid(char * const line, size_t const len)
+{
+	size_t point = char_valid_run(line, len, 0);
+
+	if (point == len) {
+		return line;
+	}
+
+	struct buffer fixed;
+	size_t start = 0;
+
+	if (!buffer_init(&fixed, len + strlen(CHAR_REPLACEMENT))) {
+		free(line);
+		return NULL;
+	}
+	for (;;) {
+		if (!buffer_append(&fixed, line + start, point - start)) {
+			break;
+		}
+		if (point == len) {
+			free(line);
+			return fixed.b;
+		}
+		if (!buffer_append(&fixed, CHAR_REPLACEMENT, strlen(CHAR_REPLACEMENT))) {
+			break;
+		}
+		start = char_next(line, len, point);
+		point = char_valid_run(line, len, start);
+	}
+	buffer_clear(&fixed);
+	free(line);
+
+	return NULL;
+}
+
 /* This function is called when minirl() is called with the standard
  * input file descriptor not attached to a TTY. So for example when the
  * program using minirl is called in pipe or with a file redirected
@@ -1359,7 +2494,7 @@ minirl_no_tty(minirl_st * const minirl)
 				free(line);
 				line = NULL;
 			}
-			return line;
+			return (line != NULL) ? line_replace_invalid(line, len) : NULL;
 		} else {
 			line[len] = c;
 			len++;
@@ -1426,113 +2561,6 @@ minirl_line_free(void * const ptr)
 }
 
 
-/*
- * Free the history, but does not reset it. Only used when we have to
- * exit() to avoid memory leaks are reported by valgrind & co.
- */
-static void
-free_history(minirl_st * const minirl)
-{
-	if (minirl->history.history != NULL) {
-		for (size_t j = 0; j < minirl->history.current_len; j++) {
-			free(minirl->history.history[j]);
-		}
-		free(minirl->history.history);
-	}
-}
-
-/*
- * This is the API call to add a new entry in the minirl history.
- * It uses a fixed array of char pointers that are shifted (memmoved)
- * when the history max length is reached in order to remove the older
- * entry and make room for the new one, so it is not exactly suitable for huge
- * histories, but will work well for a few hundred of entries.
- *
- * Using a circular buffer is smarter, but a bit more complex to handle.
- */
-int
-minirl_history_add(minirl_st * const minirl, char const * const line)
-{
-	if (minirl->history.max_len == 0) {
-		return 0;
-	}
-
-	/* Initialization on first call. */
-	if (minirl->history.history == NULL) {
-		minirl->history.history =
-			calloc(sizeof(*minirl->history.history), minirl->history.max_len);
-		if (minirl->history.history == NULL) {
-			return 0;
-		}
-	}
-
-	/* Don't add duplicated lines. */
-	if (minirl->history.current_len > 0
-	    && strcmp(minirl->history.history[minirl->history.current_len - 1], line) == 0) {
-		return 0;
-	}
-
-	/*
-	 * Add a heap allocated copy of the line in the history.
-	 * If we reached the max length, remove the older line.
-	 */
-	char * const linecopy = strdup(line);
-
-	if (linecopy == NULL) {
-		return 0;
-	}
-	if (minirl->history.current_len == minirl->history.max_len) {
-		free(minirl->history.history[0]);
-		memmove(minirl->history.history,
-			minirl->history.history + 1,
-			sizeof(char *) * (minirl->history.max_len - 1));
-		minirl->history.current_len--;
-	}
-	minirl->history.history[minirl->history.current_len] = linecopy;
-	minirl->history.current_len++;
-
-	return 1;
-}
-
-/* Set the maximum length for the history. This function can be called even
- * if there is already some history, the function will make sure to retain
- * just the latest 'len' elements if the new history length value is smaller
- * than the amount of items already inside the history. */
-int
-minirl_history_set_max_len(minirl_st * const minirl, size_t const len)
-{
-	if (len < 1) {
-		return 0;
-	}
-	if (minirl->history.history) {
-		size_t tocopy = minirl->history.current_len;
-		char ** const new_history = calloc(sizeof(*new_history), len);
-
-		if (new_history == NULL) {
-			return 0;
-		}
-
-		/* If we can't copy everything, free the elements we'll not use. */
-		if (len < tocopy) {
-			for (size_t j = 0; j < tocopy - len; j++) {
-				free(minirl->history.history[j]);
-			}
-			tocopy = len;
-		}
-		memcpy(new_history,
-		       minirl->history.history + (minirl->history.current_len - tocopy),
-		       sizeof(char *) * tocopy);
-		free(minirl->history.history);
-		minirl->history.history = new_history;
-	}
-	minirl->history.max_len = len;
-	if (minirl->history.current_len > minirl->history.max_len) {
-		minirl->history.current_len = minirl->history.max_len;
-	}
-
-	return 1;
-}
-
 void
 minirl_text_delete(minirl_st * const minirl, size_t const start, size_t const end)
 {
@@ -1545,6 +2573,7 @@ minirl_text_delete(minirl_st * const minirl, size_t const start, size_t const en
 
 	/* Move any text which is left, including the terminator */
 	char * const line = minirl_line_get(minirl);
+	minirl_state_line_removing(l, start, end);
 	memmove(&line[start], &line[start + delta], l->len + 1 - end);
 	l->len -= delta;
 
@@ -1582,112 +2611,90 @@ minirl_text_insert(minirl_st * const minirl, char const * const text)
 	return minirl_text_len_insert(minirl, text, strlen(text));
 }
 
-void
-minirl_display_matches(minirl_st * const minirl, char ** const matches)
+bool
+minirl_text_replace(
+	minirl_st * const minirl,
+	size_t const start,
+	size_t const end,
+	char const * const text,
+	size_t const length)
 {
-	size_t max;
-
-	/* Find maximum completion length. */
-	max = 0;
-	for (char **m = matches; *m != NULL; m++) {
-		size_t const size = strlen(*m);
+	minirl_state_st * const l = &minirl->state;
+	size_t const required_len = l->len - (end - start) + length;
 
-		if (max < size) {
-			max = size;
+	if (required_len >= l->line_buf->capacity) {
+		if (!buffer_grow(l->line_buf, required_len - l->line_buf->capacity)) {
+			minirl_state_had_error(l);
+			return false;
 		}
 	}
 
-	/* Allow for a space between words. */
-	size_t const num_cols = minirl_terminal_width(minirl) / (max + 1);
+	/* Move the rest of the line, including the terminator. */
+	minirl_state_line_removing(l, start, end);
+	l->non_ascii += non_ascii_count(text, length);
+	memmove(l->line_buf->b + start + length,
+		l->line_buf->b + end,
+		l->len + 1 - end);
+	memcpy(l->line_buf->b + start, text, length);
+	l->len = required_len;
+	l->pos = start + length;
 
-	/* Print out a table of completions. */
-	fprintf(minirl->out.stream, "\r\n");
-	for (char **m = matches; *m != NULL;) {
-		for (size_t c = 0; c < num_cols && *m; c++, m++) {
-			fprintf(minirl->out.stream, "%-*s ", (int)max, *m);
-		}
-		fprintf(minirl->out.stream, "\r\n");
+	/*
+	 * If the line is on a single row, both before and after, only the
+	 * row from the start of the replaced text needs to be rewritten,
+	 * unless a suggestion may need to be shown after it.
+	 */
+	if (l->flags.refresh_required
+	    || l->max_rows > 1
+	    || minirl->options.echo.disable
+	    || (minirl->suggestion.enabled && l->pos == l->len)) {
+		minirl_state_refresh_required(l);
+		return true;
 	}
-}
 
-bool
-minirl_complete(
-	minirl_st * const minirl,
-	unsigned const start,
-	char ** const matches,
-	bool const allow_prefix)
-{
-	bool did_some_completion;
-	bool prefix;
-	bool res = false;
+	internal_line_buffer_st internal;
 
-	if (matches == NULL || matches[0] == NULL) {
+	if (!internal_line_buffer_init(&internal, l, &minirl->options.echo)) {
+		minirl_state_had_error(l);
 		return false;
 	}
 
-	/* Identify a common prefix. */
-	unsigned len = strlen(matches[0]);
-	prefix = true;
-	for (size_t i = 1; matches[i] != NULL; i++) {
-		unsigned common;
-
-		for (common = 0; common < len; common++) {
-			if (matches[0][common] != matches[i][common]) {
-				break;
-			}
-		}
-		if (len != common) {
-			len = common;
-			prefix = !matches[i][len];
-		}
-	}
-
-	unsigned start_from = 0;
-	unsigned const end = minirl_point_get(minirl);
-
-	/*
-	 * The portion of the match from the start to the cursor position
-	 * matches so it's only necessary to insert from that position now.
-	 * Exclude the characters that already match.
-	 */
-	start_from = end - start;
-	len -= end - start;
+	cursor_st start_cursor;
+	cursor_st current_cursor;
+	cursor_st line_end_cursor;
 
-	/* Insert the rest of the common prefix */
+	calculate_cursor_position(l, &start_cursor, start, &internal);
+	calculate_cursor_position(l, &current_cursor, internal.edit_point, &internal);
+	calculate_cursor_position(l, &line_end_cursor, internal.end, &internal);
+	internal_line_buffer_free(&internal);
 
-	if (len > 0) {
-		if (!minirl_text_len_insert(minirl, &matches[0][start_from], len)) {
-			return false;
-		}
-		did_some_completion = true;
-	} else {
-		did_some_completion = false;
+	if (start_cursor.row != 0 || current_cursor.row != 0 || line_end_cursor.row != 0) {
+		minirl_state_refresh_required(l);
+		return true;
 	}
 
-	/* Is there only one completion? */
-	if (matches[1] == NULL) {
-		res = true;
-		goto done;
-	}
+	struct buffer ab;
+	char const clear[] = ESCAPESTR "[0K";
 
-	/* Is the prefix valid? */
-	if (prefix && allow_prefix) {
-		res = true;
-		goto done;
-	}
+	buffer_init(&ab, 20);
+	emit_set_column(&ab, start_cursor.col + 1);
+	buffer_append(&ab, l->line_buf->b + start, l->len - start);
+	/* This also clears any suggestion that was shown. */
+	buffer_append(&ab, clear, strlen(clear));
+	emit_set_column(&ab, current_cursor.col + 1);
+	minirl->suggestion.shown = false;
+	l->previous_cursor = current_cursor;
+	l->previous_line_end = line_end_cursor;
 
-	/* Display matches if no progress was made */
-	if (!did_some_completion) {
-		/*
-		 * line state needs to be reset so that the cursor isn't moved
-		 * around during the terminal refresh.
-		 */
-		minirl_display_matches(minirl, matches);
-		minirl_line_state_reset(minirl);
+	ssize_t const res = io_write(minirl->out.fd, ab.b, ab.len);
+
+	buffer_clear(&ab);
+	if (res == -1) {
+		minirl_state_had_error(l);
+		return false;
 	}
 
-done:
-	return res;
+	return true;
 }
 
 struct minirl_st *
@@ -1722,6 +2729,7 @@ minirl_new(FILE * const in_stream, FILE * const out_stream)
 	minirl_bind_key(minirl, CTRL('l'), ctrl_l_handler, NULL);
 	minirl_bind_key(minirl, CTRL('n'), down_handler, NULL);
 	minirl_bind_key(minirl, CTRL('p'), up_handler, NULL);
+	minirl_bind_key(minirl, CTRL('r'), ctrl_r_handler, NULL);
 	minirl_bind_key(minirl, CTRL('t'), ctrl_t_handler, NULL);
 	minirl_bind_key(minirl, CTRL('u'), ctrl_u_handler, NULL);
 	minirl_bind_key(minirl, CTRL('w'), ctrl_w_handler, NULL);
@@ -1739,6 +2747,9 @@ minirl_new(FILE * const in_stream, FILE * const out_stream)
 	minirl_bind_key_sequence(minirl, ESCAPESTR "[F", end_handler, NULL);
 	minirl_bind_key_sequence(minirl, ESCAPESTR "OH", home_handler, NULL);
 	minirl_bind_key_sequence(minirl, ESCAPESTR "OF", end_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "b", alt_b_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "f", alt_f_handler, NULL);
+	minirl_bind_key_sequence(minirl, ESCAPESTR "d", alt_d_handler, NULL);
 
 
 	minirl->in.stream = in_stream;
@@ -1748,7 +2759,24 @@ minirl_new(FILE * const in_stream, FILE * const out_stream)
 	minirl->out.stream = out_stream;
 	minirl->out.fd = fileno(out_stream);
 
-	minirl->history.max_len = MINIRL_DEFAULT_HISTORY_MAX_LEN;
+	minirl->search_keymap = search_keymap_new(minirl);
+	minirl->history = history_new(MINIRL_DEFAULT_HISTORY_MAX_LEN);
+	if (minirl->search_keymap == NULL
+	    || minirl->history == NULL
+	    || !complete_pager_init(minirl)) {
+		if (minirl->search_keymap != NULL) {
+			minirl_keymap_free(minirl->search_keymap);
+		}
+		if (minirl->pager.keymap != NULL) {
+			minirl_keymap_free(minirl->pager.keymap);
+		}
+		history_unref(minirl->history);
+		minirl_keymap_free(minirl->keymap);
+		free(minirl);
+		minirl = NULL;
+
+		goto done;
+	}
 
 done:
 	return minirl;
@@ -1766,8 +2794,16 @@ minirl_delete(minirl_st * const minirl)
 	}
 	minirl_keymap_free(minirl->keymap);
 	minirl->keymap = NULL;
+	minirl_keymap_free(minirl->search_keymap);
+	minirl->search_keymap = NULL;
 
-	free_history(minirl);
+	history_unref(minirl->history);
+	buffer_clear(&minirl->suggestion.line);
+	complete_async_free(minirl->async);
+	complete_cache_clear(&minirl->complete_cache);
+	complete_menu_clear(&minirl->complete_menu);
+	complete_sources_free(minirl->sources);
+	complete_pager_free(minirl);
 
 	free(minirl);
 
@@ -1811,6 +2847,25 @@ minirl_echo_enable(minirl_st * const minirl)
 	minirl->options.echo.disable = false;
 }
 
+void
+minirl_history_suggestions_enable(minirl_st * const minirl, bool const enable)
+{
+	minirl->suggestion.enabled = enable;
+	minirl->suggestion.valid = false;
+}
+
+void
+minirl_fuzzy_enable(minirl_st * const minirl, bool const enable)
+{
+	minirl->options.fuzzy = enable;
+}
+
+void
+minirl_exact_input_enable(minirl_st * const minirl, bool const enable)
+{
+	minirl->options.exact_input = enable;
+}
+
 void
 minirl_echo_disable(minirl_st * const minirl, char const echo_char)
 {
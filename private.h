@@ -2,12 +2,26 @@
 
 #include "minirl.h"
 #include "buffer.h"
+#include "complete.h"
+#include "complete_sources.h"
+#include "history.h"
 #include "key_binding.h"
 
 #include <termios.h>
 
 #define MINIRL_DEFAULT_HISTORY_MAX_LEN 100
 #define MINIRL_MAX_LINE 4096
+#define MINIRL_INPUT_BUFFER_SIZE 4096
+#define ESCAPESTR "\x1b"
+
+enum KEY_ACTION
+{
+	KEY_NULL = 0,		/* NULL */
+	TAB = 9,		/* Tab */
+	ENTER = 13,		/* Enter */
+	ESC = 27,		/* Escape */
+	BACKSPACE =  127	/* Backspace */
+};
 
 /* The minirlState structure represents the state during line editing.
  * We pass this state to functions implementing specific editing
@@ -17,10 +31,48 @@ typedef struct cursor_st {
 	int col;
 } cursor_st;
 
+typedef struct history_edit_st history_edit_st;
+
+struct history_edit_st {
+	history_edit_st *next;
+	uint64_t id;
+	char *line;
+};
+
+/* State of an incremental search of the history. */
+typedef struct history_search_st {
+	bool active;
+	size_t match;           /* The rank of the matching line being shown. */
+	struct buffer query;
+	struct buffer prompt;
+	char const *saved_prompt;
+	char *saved_line;
+	minirl_keymap_st *saved_keymap;
+} history_search_st;
+
+/*
+ * An autosuggestion, i.e. the newest history entry that extends the line,
+ * shown dimmed after the cursor.
+ * 'line' holds the entry with id 'id', or just the line if 'id' is 0 as
+ * no entry extended it. The first 'prefix_len' bytes are what the line held
+ * when the entry was found, and no newer entry starts with them, so a
+ * search for a suggestion for a longer line can carry on from 'id'.
+ */
+typedef struct history_suggestion_st {
+	bool enabled;
+	bool valid;
+	bool shown;             /* Displayed after the end of the line. */
+	uint64_t id;
+	size_t prefix_len;
+	struct buffer line;
+} history_suggestion_st;
+
 typedef struct minirl_key_handler_flags_st {
 	bool done;
 	bool refresh_required;
 	bool cursor_refresh_required;
+	/* Text was removed, so the suggestion may need to be found again. */
+	bool text_removed;
 	bool error;
 } minirl_key_handler_flags_st;
 
@@ -31,10 +83,23 @@ typedef struct minirl_state_st {
 	size_t prompt_len;      /* Prompt length. */
 	size_t pos;             /* Current cursor position. */
 	size_t len;             /* Current edited line length. */
+	/*
+	 * Bytes of the line that aren't plain ASCII (see char_is_plain_ascii()),
+	 * and whether the prompt is all plain ASCII. While the line and prompt
+	 * are, they're measured and edited a byte at a time.
+	 */
+	size_t non_ascii;
+	bool prompt_ascii;
 
 	size_t terminal_width;  /* Number of columns in terminal. */
+	/* Where the prompt leaves the cursor, for a terminal this wide. */
+	cursor_st prompt_end;
+	size_t prompt_end_width;
 	size_t max_rows;        /* Maximum num of rows used so far */
-	int history_index;      /* The history index we are currently editing. */
+	uint64_t history_id;    /* The id of the history entry being edited. */
+	/* Edits made to history entries, which are discarded once done. */
+	history_edit_st *history_edits;
+	history_search_st search;
 
 	cursor_st previous_cursor;
 	cursor_st previous_line_end;
@@ -42,6 +107,19 @@ typedef struct minirl_state_st {
 	minirl_key_handler_flags_st flags;
 } minirl_state_st;
 
+/*
+ * Input read but not yet handled. Whatever is available is read at once, so
+ * that pasted text can be inserted in one go, and anything left once the
+ * line is done is kept for the next one. With 'exact_input' set only text
+ * already waiting after a key is read with it, as any other key may end
+ * the line.
+ */
+typedef struct input_buffer_st {
+	char bytes[MINIRL_INPUT_BUFFER_SIZE];
+	size_t start;
+	size_t end;
+} input_buffer_st;
+
 typedef struct echo_st {
 	bool disable;
 	char ch;
@@ -51,6 +129,7 @@ struct minirl_st {
 	struct {
 		FILE *stream;
 		int fd;
+		input_buffer_st buffer;
 	} in;
 	struct {
 		FILE *stream;
@@ -61,18 +140,26 @@ struct minirl_st {
 	bool in_raw_mode;
 	struct termios orig_termios;
 	minirl_keymap_st *keymap;
+	minirl_keymap_st *search_keymap;
 	minirl_state_st state;
 
 	struct {
 		bool mask_mode;
 		bool force_isatty;
+		bool fuzzy;
+		bool exact_input;
 		echo_st echo;
 	} options;
 
-	struct {
-		size_t max_len;
-		size_t current_len;
-		char **history;
-	} history;
+	minirl_history_st *history;
+	history_suggestion_st suggestion;
+
+	complete_cache_st complete_cache;
+	complete_menu_st complete_menu;
+	complete_pager_st pager;
+	/* Created when completions are first requested asynchronously. */
+	complete_async_st *async;
+	/* Created when the first source of completions is added. */
+	complete_sources_st *sources;
 };
 
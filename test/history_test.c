@@ -0,0 +1,147 @@
+/*
+ * Check that the bytes of the history arena counted as live are exactly
+ * those of the entries, and that the index refers to the entries, as lines
+ * are added with the history limited to a few entries and to a number of
+ * bytes.
+ * history.c is included so that its internals can be checked directly.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "history.c"
+
+#define NUM_LINES 1000
+#define MAX_BYTES 64
+
+static bool
+check_arena(minirl_history_st const * const history, char const * const line)
+{
+	size_t live = 0;
+	size_t live_len = 0;
+
+	for (size_t i = 0; i < history->entries_len; i++) {
+		history_entry_st const * const entry = &history->entries[i];
+
+		if (entry->removed) {
+			continue;
+		}
+		if (i < history->oldest) {
+			fprintf(stderr, "entry %zu is older than the oldest\n", i);
+			return false;
+		}
+		if (entry->offset + entry->len + 1 > history->arena.len) {
+			fprintf(stderr, "entry %zu lies beyond the arena\n", i);
+			return false;
+		}
+		live += entry->len + 1;
+		live_len++;
+	}
+	if (live_len != history->current_len) {
+		fprintf(stderr, "%zu live entries counted, but there are %zu\n",
+			history->current_len, live_len);
+		return false;
+	}
+	for (size_t i = 0; i <= history->index.mask; i++) {
+		history_slot_st const * const slot = &history->index.slots[i];
+
+		if (slot->id != 0
+		    && (slot->pos >= history->entries_len
+			|| history->entries[slot->pos].id != slot->id
+			|| history->entries[slot->pos].removed)) {
+			fprintf(stderr, "slot %zu doesn't refer to its entry\n", i);
+			return false;
+		}
+	}
+	if (history->arena.len - history->dead_bytes != live) {
+		fprintf(stderr, "%zu live bytes counted, but entries hold %zu\n",
+			history->arena.len - history->dead_bytes, live);
+		return false;
+	}
+	if (history->max_bytes != 0 && live > history->max_bytes) {
+		fprintf(stderr, "%zu live bytes is over the budget\n", live);
+		return false;
+	}
+	if (history->current_len > 0
+	    && strcmp(history_line(history, history->entries_len - 1), line) != 0) {
+		fprintf(stderr, "newest entry isn't \"%s\"\n", line);
+		return false;
+	}
+
+	return true;
+}
+
+/* Check that browsing the history steps over the removed entries. */
+static bool
+check_read(minirl_history_st * const history, char const * const line)
+{
+	struct buffer line_buf;
+	size_t older = 0;
+	size_t newer = 0;
+	bool ok = true;
+
+	if (!buffer_init(&line_buf, 0)) {
+		return false;
+	}
+	for (uint64_t id = HISTORY_ID_EDIT_LINE;
+	     (id = history_read(history, id, true, &line_buf)) != 0;) {
+		if (older == 0
+		    && (line_buf.len != strlen(line)
+			|| memcmp(line_buf.b, line, line_buf.len) != 0)) {
+			fprintf(stderr, "newest entry read isn't \"%s\"\n", line);
+			ok = false;
+		}
+		older++;
+	}
+	for (uint64_t id = 0; (id = history_read(history, id, false, &line_buf)) != 0;) {
+		newer++;
+	}
+	if (older != history->current_len || newer != history->current_len) {
+		fprintf(stderr, "read %zu older and %zu newer of %zu entries\n",
+			older, newer, history->current_len);
+		ok = false;
+	}
+	buffer_clear(&line_buf);
+
+	return ok;
+}
+
+static bool
+check(size_t const max_len, size_t const max_bytes, bool const unique)
+{
+	minirl_history_st * const history = history_new(max_len);
+	char line[MAX_BYTES];
+	bool ok = true;
+
+	history->max_bytes = max_bytes;
+	history->unique = unique;
+	srand(1);
+	for (int i = 0; i < NUM_LINES && ok; i++) {
+		size_t const len = 1 + rand() % (MAX_BYTES / 2);
+
+		memset(line, 'a' + rand() % 4, len);
+		line[len] = '\0';
+		history_add(history, line);
+		ok = check_arena(history, line) && check_read(history, line);
+	}
+	printf("max_len %zu, max_bytes %zu%s: %s\n",
+	       max_len, max_bytes, unique ? ", unique" : "", ok ? "ok" : "failed");
+	history_unref(history);
+
+	return ok;
+}
+
+int
+main(void)
+{
+	bool ok = true;
+
+	ok = check(1, 0, false) && ok;
+	ok = check(1, MAX_BYTES, false) && ok;
+	ok = check(1, MAX_BYTES, true) && ok;
+	ok = check(4, MAX_BYTES, false) && ok;
+	ok = check(4, MAX_BYTES, true) && ok;
+	ok = check(4, 0, true) && ok;
+
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
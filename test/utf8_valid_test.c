@@ -0,0 +1,117 @@
+/*
+ * Check that each way utf8_valid_run() can find the end of a run of valid
+ * UTF-8 agrees with decoding the text a character at a time, for random
+ * mixes of valid, invalid and truncated sequences.
+ * utf8.c is included so that its static variants can be called directly.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utf8.c"
+
+#define NUM_RUNS 200000
+#define MAX_LEN 80
+
+typedef size_t (*valid_run_fn)(const char *s, size_t len, size_t point);
+
+static size_t
+valid_run_reference(char const * const s, size_t const len, size_t point)
+{
+	while (point < len) {
+		size_t const n = utf8_char_decode(s + point, len - point, NULL);
+
+		if (n == 0) {
+			break;
+		}
+		point += n;
+	}
+
+	return point;
+}
+
+/* Sequences, both valid and not, that the random text is made up of. */
+static char const * const pieces[] = {
+	"a", "z", " ", "~", "\x7f",
+	"\xc2\x80", "\xdf\xbf", "\xc3\xa9",
+	"\xe0\xa0\x80", "\xed\x9f\xbf", "\xef\xbf\xbd", "\xe4\xb8\xad",
+	"\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf", "\xf0\x9f\x98\x80",
+	/* Stray continuations and bytes that can't appear at all. */
+	"\x80", "\xbf", "\xc0", "\xc1", "\xf5", "\xff",
+	/* Overlong, surrogate and too large. */
+	"\xc0\xaf", "\xe0\x80\xaf", "\xe0\x9f\xbf", "\xed\xa0\x80",
+	"\xf0\x80\x80\xaf", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80",
+	/* Truncated. */
+	"\xc3", "\xe4\xb8", "\xf0\x9f", "\xf0\x9f\x98",
+};
+
+static void
+random_text(char * const s, size_t const len)
+{
+	size_t const num_pieces = sizeof pieces / sizeof pieces[0];
+	/* Mostly ASCII, so that the vector code sees whole chunks of it. */
+	int const ascii_percent = rand() % 100;
+	size_t i = 0;
+
+	while (i < len) {
+		char const *piece = (rand() % 100 < ascii_percent)
+			? pieces[rand() % 5]
+			: pieces[rand() % num_pieces];
+		size_t n = strlen(piece);
+
+		if (n > len - i) {
+			n = len - i;
+		}
+		memcpy(s + i, piece, n);
+		i += n;
+	}
+}
+
+static bool
+check(char const * const name, valid_run_fn const valid_run)
+{
+	char s[MAX_LEN];
+
+	srand(1);
+	for (int run = 0; run < NUM_RUNS; run++) {
+		size_t const len = rand() % (MAX_LEN + 1);
+		size_t const point = len > 0 ? rand() % len : 0;
+
+		random_text(s, len);
+
+		size_t const expected = valid_run_reference(s, len, point);
+		size_t const got = valid_run(s, len, point);
+
+		if (got != expected) {
+			fprintf(stderr, "%s: expected %zu got %zu, from %zu of:",
+				name, expected, got, point);
+			for (size_t i = 0; i < len; i++) {
+				fprintf(stderr, " %02x", (unsigned char)s[i]);
+			}
+			fprintf(stderr, "\n");
+			return false;
+		}
+	}
+	printf("%s: ok\n", name);
+
+	return true;
+}
+
+int
+main(void)
+{
+	bool ok = check("utf8_valid_run_scalar", utf8_valid_run_scalar);
+
+#if defined(UTF8_VEC_DISPATCH)
+	if (__builtin_cpu_supports("ssse3")) {
+		ok = check("utf8_valid_run_vec", utf8_valid_run_vec) && ok;
+	} else {
+		printf("utf8_valid_run_vec: skipped, no SSSE3\n");
+	}
+#elif defined(UTF8_VEC)
+	ok = check("utf8_valid_run_vec", utf8_valid_run_vec) && ok;
+#endif
+	ok = check("utf8_valid_run", utf8_valid_run) && ok;
+
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
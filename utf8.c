@@ -4,24 +4,28 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
-enum {
-	UTF8_GRAPHEME_BREAK_OTHER,
-	UTF8_GRAPHEME_BREAK_CR,
-	UTF8_GRAPHEME_BREAK_LF,
-	UTF8_GRAPHEME_BREAK_CONTROL,
-	UTF8_GRAPHEME_BREAK_EXTEND,
-	UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR,
-	UTF8_GRAPHEME_BREAK_PREPEND,
-	UTF8_GRAPHEME_BREAK_SPACINGMARK,
-	UTF8_GRAPHEME_BREAK_L,
-	UTF8_GRAPHEME_BREAK_V,
-	UTF8_GRAPHEME_BREAK_T,
-	UTF8_GRAPHEME_BREAK_LV,
-	UTF8_GRAPHEME_BREAK_LVT,
-	UTF8_GRAPHEME_BREAK_ZWJ,
-};
-
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__) || (defined(__x86_64__) && defined(__GNUC__))
+#include <tmmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*
+ * The enum of grapheme break classes is generated along with the tables.
+ * Builds with a layout other than the default use their own copy.
+ */
+#if defined(UTF8DATA_FILE)
+#include UTF8DATA_FILE
+#else
 #include "utf8data.c"
+#endif
 
 static bool utf8_cont(char c)
 {
@@ -151,132 +155,643 @@ size_t utf8_char_prev(const char *s, size_t len, size_t point)
 	}
 }
 
+static bool utf8_ascii_printable(char c)
+{
+	return c >= 0x20 && c < 0x7f;
+}
+
+#if defined(__SSE2__)
+/* Get a mask of the bytes that aren't printable ASCII, i.e. < 0x20 or > 0x7e. */
+static unsigned utf8_ascii_mask16(const char *s)
+{
+	__m128i v = _mm_loadu_si128((const __m128i *)s);
+
+	/* Bytes >= 0x80 are negative, so are also less than 0x20. */
+	return _mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x20)),
+					      _mm_cmpgt_epi8(v, _mm_set1_epi8(0x7e))));
+}
+#endif
+
+/*
+ * Find the end of the run of printable ASCII characters starting at
+ * 'point', checking 16 or 32 bytes at a time where possible.
+ */
 NO_EXPORT
-size_t utf8_char_width(const char *s, size_t len, size_t point)
+size_t utf8_ascii_run(const char *s, size_t len, size_t point)
 {
-	uint32_t c;
-	uint8_t i;
+#if defined(__AVX2__)
+	for (; point + 32 <= len; point += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(s + point));
+		uint32_t mask = _mm256_movemask_epi8(
+			_mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), v),
+					_mm256_cmpgt_epi8(v, _mm256_set1_epi8(0x7e))));
+
+		if (mask)
+			return point + __builtin_ctz(mask);
+	}
+#endif
+#if defined(__SSE2__)
+	unsigned mask;
+
+	for (; point + 16 <= len; point += 16) {
+		mask = utf8_ascii_mask16(s + point);
+		if (mask)
+			return point + __builtin_ctz(mask);
+	}
+	if (point < len && len >= 16) {
+		/* Check the last 16 bytes, ignoring those already checked. */
+		mask = utf8_ascii_mask16(s + len - 16) >> (point - (len - 16));
+		return mask ? point + __builtin_ctz(mask) : len;
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	for (; point + 16 <= len; point += 16) {
+		uint8x16_t v = vld1q_u8((const uint8_t *)s + point);
+		uint8x16_t bad = vorrq_u8(vcltq_u8(v, vdupq_n_u8(0x20)),
+					  vcgtq_u8(v, vdupq_n_u8(0x7e)));
+
+		/* Leave finding which byte it is to the loop below. */
+		if (vmaxvq_u8(bad))
+			break;
+	}
+#endif
+	while (point < len && utf8_ascii_printable(s[point]))
+		point++;
+	return point;
+}
 
-	utf8_char_decode(s + point, len - point, &c);
+#if defined(__SSSE3__) || (defined(__ARM_NEON) && defined(__aarch64__))
+#define UTF8_VEC
+#define UTF8_VEC_FN static
+#elif defined(__x86_64__) && defined(__GNUC__)
+/*
+ * Without SSSE3 enabled for the whole build, build the vector code for it
+ * anyway and use it if the CPU turns out to support it.
+ */
+#define UTF8_VEC
+#define UTF8_VEC_DISPATCH
+#define UTF8_VEC_FN static __attribute__((target("ssse3")))
+#endif
+
+#if defined(UTF8_VEC)
+
+/*
+ * The errors a pair of bytes can indicate, as found by looking up the high
+ * and low nibbles of the first and the high nibble of the second, following
+ * the method of Keiser and Lemire used by simdutf.
+ */
+enum {
+	UTF8_TOO_SHORT = 1 << 0,        /* A lead byte not followed by enough continuations. */
+	UTF8_TOO_LONG = 1 << 1,         /* ASCII followed by a continuation. */
+	UTF8_OVERLONG_3 = 1 << 2,
+	UTF8_TOO_LARGE = 1 << 3,
+	UTF8_SURROGATE = 1 << 4,
+	UTF8_OVERLONG_2 = 1 << 5,
+	UTF8_TOO_LARGE_1000 = 1 << 6,
+	UTF8_OVERLONG_4 = 1 << 6,
+	UTF8_TWO_CONTS = 1 << 7,        /* Continuations where none are expected. */
+	UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS,
+};
+
+static const uint8_t utf8_byte1_high[16] = {
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+	UTF8_TOO_SHORT,
+	UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+static const uint8_t utf8_byte1_low[16] = {
+	UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+	UTF8_CARRY | UTF8_OVERLONG_2,
+	UTF8_CARRY,
+	UTF8_CARRY,
+	UTF8_CARRY | UTF8_TOO_LARGE,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+static const uint8_t utf8_byte2_high[16] = {
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+};
+
+/* Lead bytes in the last three places that want more bytes than are left. */
+static const uint8_t utf8_incomplete_max[16] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1,
+};
+
+#if defined(__SSSE3__) || defined(UTF8_VEC_DISPATCH)
+typedef __m128i utf8_vec;
+
+UTF8_VEC_FN utf8_vec utf8_vec_load(const void *s) { return _mm_loadu_si128((const __m128i *)s); }
+UTF8_VEC_FN utf8_vec utf8_vec_lookup(const uint8_t *table, utf8_vec i) { return _mm_shuffle_epi8(utf8_vec_load(table), i); }
+UTF8_VEC_FN utf8_vec utf8_vec_high(utf8_vec v) { return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)); }
+UTF8_VEC_FN utf8_vec utf8_vec_low(utf8_vec v) { return _mm_and_si128(v, _mm_set1_epi8(0x0f)); }
+UTF8_VEC_FN utf8_vec utf8_vec_and(utf8_vec a, utf8_vec b) { return _mm_and_si128(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_or(utf8_vec a, utf8_vec b) { return _mm_or_si128(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_xor(utf8_vec a, utf8_vec b) { return _mm_xor_si128(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_subs(utf8_vec a, utf8_vec b) { return _mm_subs_epu8(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_dup(uint8_t b) { return _mm_set1_epi8(b); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev1(utf8_vec v, utf8_vec prev) { return _mm_alignr_epi8(v, prev, 15); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev2(utf8_vec v, utf8_vec prev) { return _mm_alignr_epi8(v, prev, 14); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev3(utf8_vec v, utf8_vec prev) { return _mm_alignr_epi8(v, prev, 13); }
+UTF8_VEC_FN bool utf8_vec_any(utf8_vec v) { return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0xffff; }
+UTF8_VEC_FN bool utf8_vec_ascii(utf8_vec v) { return _mm_movemask_epi8(v) == 0; }
+#else
+typedef uint8x16_t utf8_vec;
+
+UTF8_VEC_FN utf8_vec utf8_vec_load(const void *s) { return vld1q_u8(s); }
+UTF8_VEC_FN utf8_vec utf8_vec_lookup(const uint8_t *table, utf8_vec i) { return vqtbl1q_u8(vld1q_u8(table), i); }
+UTF8_VEC_FN utf8_vec utf8_vec_high(utf8_vec v) { return vshrq_n_u8(v, 4); }
+UTF8_VEC_FN utf8_vec utf8_vec_low(utf8_vec v) { return vandq_u8(v, vdupq_n_u8(0x0f)); }
+UTF8_VEC_FN utf8_vec utf8_vec_and(utf8_vec a, utf8_vec b) { return vandq_u8(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_or(utf8_vec a, utf8_vec b) { return vorrq_u8(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_xor(utf8_vec a, utf8_vec b) { return veorq_u8(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_subs(utf8_vec a, utf8_vec b) { return vqsubq_u8(a, b); }
+UTF8_VEC_FN utf8_vec utf8_vec_dup(uint8_t b) { return vdupq_n_u8(b); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev1(utf8_vec v, utf8_vec prev) { return vextq_u8(prev, v, 15); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev2(utf8_vec v, utf8_vec prev) { return vextq_u8(prev, v, 14); }
+UTF8_VEC_FN utf8_vec utf8_vec_prev3(utf8_vec v, utf8_vec prev) { return vextq_u8(prev, v, 13); }
+UTF8_VEC_FN bool utf8_vec_any(utf8_vec v) { return vmaxvq_u8(v) != 0; }
+UTF8_VEC_FN bool utf8_vec_ascii(utf8_vec v) { return vmaxvq_u8(v) < 0x80; }
+#endif
+
+/*
+ * Find any errors in the 16 bytes 'v', given the 16 before them 'prev', as
+ * non-zero bytes in the result.
+ */
+UTF8_VEC_FN utf8_vec utf8_vec_check(utf8_vec v, utf8_vec prev)
+{
+	utf8_vec prev1 = utf8_vec_prev1(v, prev);
+	utf8_vec special = utf8_vec_and(utf8_vec_and(
+		utf8_vec_lookup(utf8_byte1_high, utf8_vec_high(prev1)),
+		utf8_vec_lookup(utf8_byte1_low, utf8_vec_low(prev1))),
+		utf8_vec_lookup(utf8_byte2_high, utf8_vec_high(v)));
+
+	/* The third and fourth bytes of a sequence must be continuations. */
+	utf8_vec must23 = utf8_vec_or(
+		utf8_vec_subs(utf8_vec_prev2(v, prev), utf8_vec_dup(0xe0 - 0x80)),
+		utf8_vec_subs(utf8_vec_prev3(v, prev), utf8_vec_dup(0xf0 - 0x80)));
+
+	return utf8_vec_xor(utf8_vec_and(must23, utf8_vec_dup(0x80)), special);
+}
+#endif
+
+/*
+ * Find the end of the run of valid UTF-8 starting at 'point' a character at
+ * a time, skipping over chunks of ASCII where possible.
+ */
+static size_t utf8_valid_run_scalar(const char *s, size_t len, size_t point)
+{
+	size_t n;
+
+#if defined(__SSE2__)
+	while (point + 16 <= len && _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + point))) == 0)
+		point += 16;
+#endif
+	while (point < len) {
+		if ((s[point] & 0x80) == 0) {
+			point++;
+			continue;
+		}
+		n = utf8_char_decode(s + point, len - point, NULL);
+		if (n == 0)
+			break;
+		point += n;
+	}
+	return point;
+}
+
+#if defined(UTF8_VEC)
+/*
+ * As utf8_valid_run_scalar(), but checking 16 bytes at a time, and only
+ * once an error is found looking for its position a character at a time.
+ */
+UTF8_VEC_FN size_t utf8_valid_run_vec(const char *s, size_t len, size_t point)
+{
+	utf8_vec prev = utf8_vec_dup(0);
+	utf8_vec incomplete = utf8_vec_dup(0);
+	utf8_vec error;
+	size_t start = point;
+	size_t n;
+
+	for (; point + 16 <= len; point += 16) {
+		utf8_vec v = utf8_vec_load(s + point);
+
+		if (utf8_vec_ascii(v)) {
+			/* Fine, unless the last chunk ended part way through a sequence. */
+			error = incomplete;
+			incomplete = utf8_vec_dup(0);
+		} else {
+			error = utf8_vec_check(v, prev);
+			incomplete = utf8_vec_subs(v, utf8_vec_load(utf8_incomplete_max));
+		}
+		if (utf8_vec_any(error))
+			break;
+		prev = v;
+	}
+
+	/*
+	 * Go back to the start of the sequence that the last chunk checked
+	 * may have ended in, which is at most 3 bytes back.
+	 */
+	n = point - start < 3 ? start : point - 3;
+	while (n < point && utf8_cont(s[n]))
+		n++;
+	return utf8_valid_run_scalar(s, len, n);
+}
+#endif
+
+/*
+ * Find the end of the run of valid UTF-8 starting at 'point', i.e. 'len' or
+ * the start of the first invalid or incomplete sequence.
+ */
+NO_EXPORT
+size_t utf8_valid_run(const char *s, size_t len, size_t point)
+{
+#if defined(UTF8_VEC_DISPATCH)
+	if (__builtin_cpu_supports("ssse3"))
+		return utf8_valid_run_vec(s, len, point);
+	return utf8_valid_run_scalar(s, len, point);
+#elif defined(UTF8_VEC)
+	return utf8_valid_run_vec(s, len, point);
+#else
+	return utf8_valid_run_scalar(s, len, point);
+#endif
+}
+
+/*
+ * Look up the width and grapheme break class of a codepoint, which are
+ * packed into a byte, taking the first 256 codepoints straight from a flat
+ * table.
+ */
+#ifdef UTF8DATA_COMPACT
+/*
+ * The rest are found by bisecting the lists of the ranges of codepoints
+ * with the same properties, which is slower than the multi-stage table but
+ * takes about half the space.
+ */
+static uint8_t utf8_props(uint32_t c)
+{
+	size_t lo = 0, hi, mid;
+
+	if (c < 0x100)
+		return props_latin1[c];
+	if (c < 0x10000) {
+		/* The first range starts at 0x100. */
+		hi = sizeof(props_bmp_start) / sizeof(props_bmp_start[0]);
+		while (hi - lo > 1) {
+			mid = (lo + hi) / 2;
+			if (props_bmp_start[mid] <= c)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return props_bmp[lo];
+	}
+	if (c >= 0x110000)
+		return 0;
+	/* The first range starts at 0x10000. */
+	hi = sizeof(props_astral) / sizeof(props_astral[0]);
+	while (hi - lo > 1) {
+		mid = (lo + hi) / 2;
+		if (props_astral[mid] >> 8 <= c)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	return props_astral[lo] & 0xff;
+}
+#else
+static uint8_t utf8_props(uint32_t c)
+{
+	unsigned i;
+
+	if (c < 0x100)
+		return props_latin1[c];
 	if (c >= 0x110000)
 		return 0;
-	i = width0[c >> width0_shift];
-	i = width1[i][(c >> width1_shift) & width1_mask];
-	i = width2[i][(c >> width2_shift) & width2_mask];
-	return (i >> ((c & width3_mask) * width_val_shift)) & width_val_mask;
+	i = props0[c >> props0_shift];
+	i = props1[i][(c >> props1_shift) & props1_mask];
+	return props2[i][c & props2_mask];
 }
+#endif
 
-static int utf8_grapheme_boundary_class(uint32_t c)
+static size_t utf8_props_width(uint8_t props)
 {
-	uint8_t i;
+	return props & props_width_mask;
+}
 
-	i = grapheme_break0[c >> grapheme_break0_shift];
-	i = grapheme_break1[i][(c >> grapheme_break1_shift) & grapheme_break1_mask];
-	i = grapheme_break2[i][(c >> grapheme_break2_shift) & grapheme_break2_mask];
-	return (i >> ((c & grapheme_break3_mask) * grapheme_break_val_shift)) & grapheme_break_val_mask;
+static int utf8_props_break(uint8_t props)
+{
+	return (props >> props_break_shift) & props_break_mask;
 }
 
-static bool utf8_grapheme_break(uint32_t c1, uint32_t c2)
+static int utf8_props_word(uint8_t props)
 {
-	int b1, b2;
+	return (props >> props_word_shift) & props_word_mask;
+}
 
-	b1 = utf8_grapheme_boundary_class(c1);
-	b2 = utf8_grapheme_boundary_class(c2);
+NO_EXPORT
+size_t utf8_char_width(const char *s, size_t len, size_t point)
+{
+	uint32_t c;
 
-	/* GB3 */
-	if (b1 == UTF8_GRAPHEME_BREAK_CR && b2 == UTF8_GRAPHEME_BREAK_LF)
-		return false;
+	utf8_char_decode(s + point, len - point, &c);
+	return utf8_props_width(utf8_props(c));
+}
 
-	/* GB4 */
-	if (b1 == UTF8_GRAPHEME_BREAK_CR || b1 == UTF8_GRAPHEME_BREAK_LF || b1 == UTF8_GRAPHEME_BREAK_CONTROL)
-		return true;
+/*
+ * Decode the codepoint at 'point', returning where the next one starts.
+ * Invalid bytes decode as 0, and any stray continuation bytes are stepped
+ * over as utf8_char_next() does.
+ */
+static size_t utf8_decode_next(const char *s, size_t len, size_t point, uint32_t *c)
+{
+	size_t next = point + utf8_char_decode(s + point, len - point, c);
 
-	/* GB5 */
-	if (b2 == UTF8_GRAPHEME_BREAK_CR || b2 == UTF8_GRAPHEME_BREAK_LF || b2 == UTF8_GRAPHEME_BREAK_CONTROL)
-		return true;
+	if (next == point)
+		return utf8_char_next(s, len, point);
+	while (next < len && utf8_cont(s[next]))
+		next++;
+	return next;
+}
 
-	/* GB6 */
-	if (b1 == UTF8_GRAPHEME_BREAK_L && (b2 == UTF8_GRAPHEME_BREAK_L || b2 == UTF8_GRAPHEME_BREAK_V || b2 == UTF8_GRAPHEME_BREAK_LV || b2 == UTF8_GRAPHEME_BREAK_LVT))
-		return false;
+/* Decode the codepoint before 'point', returning where it starts. */
+static size_t utf8_decode_prev(const char *s, size_t len, size_t point, uint32_t *c)
+{
+	size_t prev = utf8_char_prev(s, len, point);
 
-	/* GB7 */
-	if ((b1 == UTF8_GRAPHEME_BREAK_LV || b1 == UTF8_GRAPHEME_BREAK_V) && (b2 == UTF8_GRAPHEME_BREAK_V || b2 == UTF8_GRAPHEME_BREAK_T))
-		return false;
+	utf8_char_decode(s + prev, len - prev, c);
+	return prev;
+}
 
-	/* GB8 */
-	if ((b1 == UTF8_GRAPHEME_BREAK_LVT || b1 == UTF8_GRAPHEME_BREAK_T) && b2 == UTF8_GRAPHEME_BREAK_T)
-		return false;
+static int utf8_grapheme_class_at(const char *s, size_t len, size_t point)
+{
+	uint32_t c;
 
-	/* GB8a */
-	if (b1 == UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR && b2 == UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR)
-		return false;
+	utf8_char_decode(s + point, len - point, &c);
+	return utf8_props_break(utf8_props(c));
+}
 
-	/* GB9 */
-	if (b2 == UTF8_GRAPHEME_BREAK_EXTEND || b2 == UTF8_GRAPHEME_BREAK_ZWJ)
-		return false;
+/*
+ * Find whether there's a break between the codepoint at 'point', of class
+ * 'b1', and one of class 'b2' after it, when reading backwards.
+ * The state machine only needs to be started from 'b1' to decide, but for
+ * a pair of regional indicators or a ZWJ and a pictograph, where it depends
+ * on those before.
+ */
+static bool utf8_grapheme_break_before(const char *s, size_t len, size_t point, int b1, int b2)
+{
+	int state;
+	size_t n;
+
+	/* GB12, GB13 */
+	if (b1 == UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR && b2 == UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR) {
+		for (n = 1; point > 0; n++) {
+			point = utf8_char_prev(s, len, point);
+			if (utf8_grapheme_class_at(s, len, point) != UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR)
+				break;
+		}
+		return n % 2 == 0;
+	}
 
-	/* GB9a */
-	if (b2 == UTF8_GRAPHEME_BREAK_SPACINGMARK)
-		return false;
+	/* GB11 */
+	if (b1 == UTF8_GRAPHEME_BREAK_ZWJ && b2 == UTF8_GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC) {
+		while (point > 0) {
+			point = utf8_char_prev(s, len, point);
+			b1 = utf8_grapheme_class_at(s, len, point);
+			if (b1 != UTF8_GRAPHEME_BREAK_EXTEND)
+				return b1 != UTF8_GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC;
+		}
+		return true;
+	}
 
-	/* GB9b */
-	if (b1 == UTF8_GRAPHEME_BREAK_PREPEND)
-		return false;
+	state = grapheme_dfa[0][b1] & grapheme_dfa_state_mask;
+	return grapheme_dfa[state][b2] & grapheme_dfa_break;
+}
 
-	/* GB10 */
-	return true;
+/*
+ * A pictograph joined onto another by a ZWJ is drawn as part of it, so adds
+ * nothing to the width of the cluster.
+ */
+static bool utf8_grapheme_joined(int b1, int b2)
+{
+	return b1 == UTF8_GRAPHEME_BREAK_ZWJ && b2 == UTF8_GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC;
 }
 
 NO_EXPORT
-size_t utf8_grapheme_next(const char *s, size_t len, size_t point)
+void utf8_grapheme_cursor_init(struct utf8_grapheme_cursor *cursor, const char *s, size_t len, size_t point)
+{
+	cursor->s = s;
+	cursor->len = len;
+	cursor->point = point;
+	cursor->ahead_valid = false;
+	cursor->behind_valid = false;
+}
+
+NO_EXPORT
+bool utf8_grapheme_cursor_next(struct utf8_grapheme_cursor *cursor, size_t *start, size_t *end, size_t *pwidth)
 {
-	uint32_t c1, c2;
+	const char *s = cursor->s;
+	size_t len = cursor->len;
+	size_t point = cursor->point;
+	size_t next, width;
+	uint32_t c;
+	uint8_t p1, p2, t;
+	int state;
+
+	if (point >= len)
+		return false;
+
+	/* The first codepoint was looked up when the last cluster ended. */
+	if (cursor->ahead_valid) {
+		p1 = cursor->ahead_props;
+		next = cursor->ahead_next;
+	} else {
+		next = utf8_decode_next(s, len, point, &c);
+		p1 = utf8_props(c);
+	}
+	width = utf8_props_width(p1);
+	state = grapheme_dfa[0][utf8_props_break(p1)] & grapheme_dfa_state_mask;
+	*start = point;
 
-	utf8_char_decode(s + point, len - point, &c1);
+	cursor->ahead_valid = false;
 	for (;;) {
-		point = utf8_char_next(s, len, point);
+		point = next;
 		if (point >= len)
-			return point;
-		utf8_char_decode(s + point, len - point, &c2);
-		if (utf8_grapheme_break(c1, c2))
-			return point;
-		c1 = c2;
+			break;
+		next = utf8_decode_next(s, len, point, &c);
+		p2 = utf8_props(c);
+		t = grapheme_dfa[state][utf8_props_break(p2)];
+		if (t & grapheme_dfa_break) {
+			cursor->ahead_valid = true;
+			cursor->ahead_props = p2;
+			cursor->ahead_next = next;
+			break;
+		}
+		if (!utf8_grapheme_joined(utf8_props_break(p1), utf8_props_break(p2)))
+			width += utf8_props_width(p2);
+		state = t & grapheme_dfa_state_mask;
+		p1 = p2;
 	}
+
+	cursor->point = point;
+	cursor->behind_valid = false;
+	*end = point;
+	if (pwidth)
+		*pwidth = width;
+	return true;
 }
 
 NO_EXPORT
-size_t utf8_grapheme_prev(const char *s, size_t len, size_t point)
+bool utf8_grapheme_cursor_prev(struct utf8_grapheme_cursor *cursor, size_t *start, size_t *end, size_t *pwidth)
 {
-	uint32_t c1, c2;
-	size_t prev;
+	const char *s = cursor->s;
+	size_t len = cursor->len;
+	size_t point = cursor->point;
+	size_t prev, width;
+	uint32_t c;
+	uint8_t p1, p2;
+
+	if (point == 0)
+		return false;
+	*end = point;
+
+	/* The last codepoint was looked up when the last cluster ended. */
+	if (cursor->behind_valid) {
+		p2 = cursor->behind_props;
+		point = cursor->behind_start;
+	} else {
+		point = utf8_decode_prev(s, len, point, &c);
+		p2 = utf8_props(c);
+	}
+	width = utf8_props_width(p2);
 
-	point = utf8_char_prev(s, len, point);
-	utf8_char_decode(s + point, len - point, &c2);
+	cursor->behind_valid = false;
 	for (;;) {
 		if (point == 0)
-			return point;
-		prev = utf8_char_prev(s, len, point);
-		utf8_char_decode(s + prev, len - prev, &c1);
-		if (utf8_grapheme_break(c1, c2))
-			return point;
+			break;
+		prev = utf8_decode_prev(s, len, point, &c);
+		p1 = utf8_props(c);
+		if (utf8_grapheme_break_before(s, len, prev, utf8_props_break(p1), utf8_props_break(p2))) {
+			cursor->behind_valid = true;
+			cursor->behind_props = p1;
+			cursor->behind_start = prev;
+			break;
+		}
+		/* The width of the pictograph was counted before its ZWJ was seen. */
+		if (utf8_grapheme_joined(utf8_props_break(p1), utf8_props_break(p2)))
+			width -= utf8_props_width(p2);
+		width += utf8_props_width(p1);
 		point = prev;
-		c2 = c1;
+		p2 = p1;
 	}
+
+	cursor->point = point;
+	cursor->ahead_valid = false;
+	*start = point;
+	if (pwidth)
+		*pwidth = width;
+	return true;
 }
 
 NO_EXPORT
-size_t utf8_grapheme_width(const char *s, size_t len, size_t point, size_t *pnext)
+size_t utf8_grapheme_next(const char *s, size_t len, size_t point)
+{
+	struct utf8_grapheme_cursor cursor;
+	size_t start, end;
+
+	utf8_grapheme_cursor_init(&cursor, s, len, point);
+	return utf8_grapheme_cursor_next(&cursor, &start, &end, NULL) ? end : len;
+}
+
+NO_EXPORT
+size_t utf8_grapheme_prev(const char *s, size_t len, size_t point)
 {
-	size_t next;
-	size_t width;
-	size_t i;
+	struct utf8_grapheme_cursor cursor;
+	size_t start, end;
 
-	next = utf8_grapheme_next(s, len, point);
-	if (pnext) *pnext = next;
+	utf8_grapheme_cursor_init(&cursor, s, len, point);
+	return utf8_grapheme_cursor_prev(&cursor, &start, &end, NULL) ? start : 0;
+}
+
+NO_EXPORT
+size_t utf8_grapheme_width(const char *s, size_t len, size_t point, size_t *pnext)
+{
+	struct utf8_grapheme_cursor cursor;
+	size_t start, end, width;
 
-	width = 0;
-	for (i = point; i < next; i = utf8_char_next(s, len, i))
-		width += utf8_char_width(s, len, i);
+	utf8_grapheme_cursor_init(&cursor, s, len, point);
+	if (!utf8_grapheme_cursor_next(&cursor, &start, &end, &width)) {
+		end = len;
+		width = 0;
+	}
+	if (pnext) *pnext = end;
 	return width;
 }
 
+/* A grapheme cluster is part of a word if its first codepoint is. */
+static bool utf8_word_at(const char *s, size_t len, size_t point)
+{
+	uint32_t c;
+
+	utf8_char_decode(s + point, len - point, &c);
+	return utf8_props_word(utf8_props(c)) == UTF8_WORD_CLASS_WORD;
+}
+
+/*
+ * Find the end of the next word after 'point', passing over anything that
+ * separates words before it. Only whole grapheme clusters are passed over.
+ */
+NO_EXPORT
+size_t utf8_word_next(const char *s, size_t len, size_t point)
+{
+	struct utf8_grapheme_cursor cursor;
+	size_t start, end;
+	bool in_word = false;
+
+	utf8_grapheme_cursor_init(&cursor, s, len, point);
+	while (utf8_grapheme_cursor_next(&cursor, &start, &end, NULL)) {
+		if (utf8_word_at(s, len, start))
+			in_word = true;
+		else if (in_word)
+			return start;
+	}
+	return len;
+}
+
+/* As utf8_word_next(), but finding the start of the word before 'point'. */
+NO_EXPORT
+size_t utf8_word_prev(const char *s, size_t len, size_t point)
+{
+	struct utf8_grapheme_cursor cursor;
+	size_t start, end;
+	bool in_word = false;
+
+	utf8_grapheme_cursor_init(&cursor, s, len, point);
+	while (utf8_grapheme_cursor_prev(&cursor, &start, &end, NULL)) {
+		if (utf8_word_at(s, len, start))
+			in_word = true;
+		else if (in_word)
+			return end;
+	}
+	return 0;
+}
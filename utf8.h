@@ -1,15 +1,42 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/*
+ * A position in a string, from which the grapheme clusters after or before it
+ * can be read in turn. The properties of the codepoint found beyond the end
+ * of a cluster are kept for the next one, so each is only decoded once.
+ */
+struct utf8_grapheme_cursor {
+	const char *s;
+	size_t len;
+	size_t point;
+
+	bool ahead_valid;
+	uint8_t ahead_props;
+	size_t ahead_next;
+
+	bool behind_valid;
+	uint8_t behind_props;
+	size_t behind_start;
+};
+
 size_t utf8_char_len(char c);
 size_t utf8_char_decode(const char *s, size_t len, uint32_t *dst);
 size_t utf8_char_encode(uint32_t c, char *s, size_t len);
 size_t utf8_char_next(const char *s, size_t len, size_t point);
 size_t utf8_char_prev(const char *s, size_t len, size_t point);
 size_t utf8_char_width(const char *s, size_t len, size_t point);
+size_t utf8_ascii_run(const char *s, size_t len, size_t point);
+size_t utf8_valid_run(const char *s, size_t len, size_t point);
 size_t utf8_grapheme_next(const char *s, size_t len, size_t point);
 size_t utf8_grapheme_prev(const char *s, size_t len, size_t point);
 size_t utf8_grapheme_width(const char *s, size_t len, size_t point, size_t *pnext);
+void utf8_grapheme_cursor_init(struct utf8_grapheme_cursor *cursor, const char *s, size_t len, size_t point);
+bool utf8_grapheme_cursor_next(struct utf8_grapheme_cursor *cursor, size_t *start, size_t *end, size_t *width);
+bool utf8_grapheme_cursor_prev(struct utf8_grapheme_cursor *cursor, size_t *start, size_t *end, size_t *width);
+size_t utf8_word_next(const char *s, size_t len, size_t point);
+size_t utf8_word_prev(const char *s, size_t len, size_t point);
 
@@ -1,3561 +1,1841 @@
-static const uint8_t width2[][8] = {
+enum {
+	UTF8_GRAPHEME_BREAK_OTHER,
+	UTF8_GRAPHEME_BREAK_CR,
+	UTF8_GRAPHEME_BREAK_LF,
+	UTF8_GRAPHEME_BREAK_CONTROL,
+	UTF8_GRAPHEME_BREAK_EXTEND,
+	UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR,
+	UTF8_GRAPHEME_BREAK_PREPEND,
+	UTF8_GRAPHEME_BREAK_SPACINGMARK,
+	UTF8_GRAPHEME_BREAK_L,
+	UTF8_GRAPHEME_BREAK_V,
+	UTF8_GRAPHEME_BREAK_T,
+	UTF8_GRAPHEME_BREAK_LV,
+	UTF8_GRAPHEME_BREAK_LVT,
+	UTF8_GRAPHEME_BREAK_ZWJ,
+	UTF8_GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC,
+};
+
+static const int props_width_mask = 0x3;
+static const int props_break_shift = 2;
+static const int props_break_mask = 0xf;
+
+enum {
+	UTF8_WORD_CLASS_OTHER,
+	UTF8_WORD_CLASS_WORD,
+};
+
+static const int props_word_shift = 6;
+static const int props_word_mask = 0x1;
+
+static const uint8_t grapheme_dfa[][15] = {
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x87, 0x86, 0x00, 0x83, 0x84, 0x85, 0x84, 0x85, 0x00, 0x88 },	/* Other */
+	{ 0x80, 0x81, 0x02, 0x82, 0x80, 0x87, 0x86, 0x80, 0x83, 0x84, 0x85, 0x84, 0x85, 0x80, 0x88 },	/* CR */
+	{ 0x80, 0x81, 0x82, 0x82, 0x80, 0x87, 0x86, 0x80, 0x83, 0x84, 0x85, 0x84, 0x85, 0x80, 0x88 },	/* Control */
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x87, 0x86, 0x00, 0x03, 0x04, 0x85, 0x04, 0x05, 0x00, 0x88 },	/* L */
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x87, 0x86, 0x00, 0x83, 0x04, 0x05, 0x84, 0x85, 0x00, 0x88 },	/* V */
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x87, 0x86, 0x00, 0x83, 0x84, 0x05, 0x84, 0x85, 0x00, 0x88 },	/* T */
+	{ 0x00, 0x81, 0x82, 0x82, 0x00, 0x07, 0x06, 0x00, 0x03, 0x04, 0x05, 0x04, 0x05, 0x00, 0x08 },	/* Prepend */
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x00, 0x86, 0x00, 0x83, 0x84, 0x85, 0x84, 0x85, 0x00, 0x88 },	/* Regional_Indicator */
+	{ 0x80, 0x81, 0x82, 0x82, 0x08, 0x87, 0x86, 0x00, 0x83, 0x84, 0x85, 0x84, 0x85, 0x09, 0x88 },	/* Extended_Pictographic */
+	{ 0x80, 0x81, 0x82, 0x82, 0x00, 0x87, 0x86, 0x00, 0x83, 0x84, 0x85, 0x84, 0x85, 0x00, 0x08 },	/* Extended_Pictographic_ZWJ */
+};
+
+static const int grapheme_dfa_break = 0x80;
+static const int grapheme_dfa_state_mask = 0x7f;
+
+/* props: 14896 bytes (props0 2176, props1 5696, props2 6768, props_latin1 256) */
+
+static const uint8_t props2[][16] = {
 	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x08, 0x0C, 0x0C, 0x04, 0x0C, 0x0C,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x0C,
 	},
 	{
-		0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x79, 0x41, 0x01, 0x41, 0x0D, 0x79, 0x41,
 	},
 	{
-		0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x01,
 	},
 	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41,
 	},
 	{
-		0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x51, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x50,
 	},
 	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,
+		0x01, 0x50, 0x50, 0x01, 0x50, 0x50, 0x01, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00,
+		0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x0C, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+		0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x18, 0x41, 0x50,
 	},
 	{
-		0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x18,
 	},
 	{
-		0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+		0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41,
 	},
 	{
-		0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41,
 	},
 	{
-		0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x41, 0x41, 0x01, 0x41,
 	},
 	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+		0x18, 0x18, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55,
+		0x50, 0x50, 0x18, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x5D, 0x50, 0x41, 0x5D, 0x5D,
 	},
 	{
-		0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x5D, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55,
+		0x41, 0x41, 0x50, 0x50, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x51, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+		0x5D, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x5D, 0x5D, 0x41, 0x41, 0x5D, 0x5D, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
+		0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x50, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
+		0x41, 0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x5D, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
+		0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+		0x50, 0x50, 0x41, 0x41, 0x41, 0x50, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
+		0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x5D, 0x41, 0x5D, 0x5D, 0x50, 0x41, 0x41,
 	},
 	{
-		0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00,
+		0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x51, 0x50,
 	},
 	{
-		0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+		0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x5D,
 	},
 	{
-		0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+		0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x5D, 0x50, 0x41, 0x41,
 	},
 	{
-		0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51,
+		0x50, 0x5D, 0x5D, 0x5D, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01,
+		0x50, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x5D, 0x5D, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x5D, 0x50,
 	},
 	{
-		0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51,
+		0x5D, 0x5D, 0x51, 0x5D, 0x5D, 0x41, 0x50, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x41, 0x51, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55,
+		0x5D, 0x50, 0x50, 0x50, 0x50, 0x41, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x5D, 0x50, 0x59, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x51,
 	},
 	{
-		0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
+		0x5D, 0x5D, 0x50, 0x50, 0x50, 0x41, 0x50, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x51,
 	},
 	{
-		0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x5D, 0x5D, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x41, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01,
 	},
 	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x41, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x41, 0x01, 0x41, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x50, 0x41, 0x50, 0x01, 0x01, 0x01, 0x01, 0x5D, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D,
 	},
 	{
-		0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55,
+		0x50, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x41,
 	},
 	{
-		0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x50, 0x41, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41,
 	},
 	{
-		0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59,
+		0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
 	},
 	{
-		0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
 	},
 	{
-		0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
 	},
 	{
-		0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55,
+		0x41, 0x41, 0x50, 0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x50, 0x50, 0x5D, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
+		0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x41, 0x41, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x50, 0x50, 0x50, 0x0C, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x50, 0x50, 0x50, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x5D, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x81, 0xAA,
+		0x5D, 0x5D, 0x50, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x41, 0x41, 0x01, 0x01,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x50, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41,
 	},
 	{
-		0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x50, 0x41, 0x50, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x5D,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A,
+		0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41,
 	},
 	{
-		0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x51, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x5D, 0x5D, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05,
+		0x5D, 0x5D, 0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
+		0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41,
 	},
 	{
-		0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x50, 0x41, 0x41,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x5D, 0x50, 0x50, 0x5D, 0x5D, 0x5D, 0x50, 0x5D, 0x50,
 	},
 	{
-		0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56,
+		0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01,
 	},
 	{
-		0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x01, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x10, 0x34, 0x0C, 0x0C,
 	},
 	{
-		0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x01,
 	},
 	{
-		0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x01, 0x01, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+		0x41, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x01, 0x39, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x5A, 0x55,
+		0x01, 0x01, 0x41, 0x01, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x4D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41,
 	},
 	{
-		0xAA, 0x6A, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x7A, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x02, 0x02, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79,
 	},
 	{
-		0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79,
 	},
 	{
-		0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x7A, 0x79, 0x79, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
+		0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x7A, 0x7A, 0x41,
 	},
 	{
-		0x45, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x41, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
 	},
 	{
-		0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55,
+		0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A,
 	},
 	{
-		0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+		0x79, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79,
 	},
 	{
-		0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
+		0x79, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+		0x79, 0x79, 0x7A, 0x7A, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x7A, 0x79, 0x79,
 	},
 	{
-		0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x41, 0x41, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79,
 	},
 	{
-		0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x79, 0x79, 0x79, 0x41, 0x79, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
+		0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
+		0x41, 0x41, 0x41, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x79, 0x41, 0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x41, 0x7A, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55,
+		0x41, 0x41, 0x41, 0x7A, 0x7A, 0x7A, 0x41, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x7A, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55,
+		0x41, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
+		0x7A, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
+		0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x7A, 0x41, 0x41, 0x41,
 	},
 	{
-		0x54, 0x15, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55,
+		0x7A, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+		0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55,
+		0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50,
 	},
 	{
-		0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0xAA, 0x54, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xA9, 0xAA, 0x69,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x6A, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x6A, 0x59, 0x55, 0x55,
+		0x02, 0x02, 0x02, 0x02, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
 	},
 	{
-		0x55, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x02, 0x02, 0x42, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x50, 0x50, 0x50, 0x50, 0x52, 0x52,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41,
+		0x3A, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3A, 0x42, 0x41,
 	},
 	{
-		0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x50, 0x50, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x02, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41,
 	},
 	{
-		0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7A, 0x42, 0x7A, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
 	},
 	{
-		0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41,
 	},
 	{
-		0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01,
 	},
 	{
-		0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x50, 0x01, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50,
 	},
 	{
-		0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x5D, 0x5D, 0x50, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x6A, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0x56, 0x55, 0x5A, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
 	},
 	{
-		0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01,
 	},
 	{
-		0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA,
+		0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x41, 0x01, 0x41, 0x41, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x01,
 	},
 	{
-		0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA,
+		0x50, 0x50, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01,
 	},
 	{
-		0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,
+		0x41, 0x41, 0x41, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x5D, 0x5D,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+		0x5D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55,
+		0x5D, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
+		0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x5D, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0x55, 0xAA,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x41,
 	},
 	{
-		0x55, 0x55, 0x95, 0x56, 0x55, 0xAA, 0xAA, 0x56,
+		0x50, 0x41, 0x50, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0x55, 0x56, 0x55, 0x55, 0x55,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x50, 0x50, 0x5D, 0x5D,
 	},
 	{
-		0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x01, 0x01, 0x41, 0x41, 0x41, 0x5D, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA,
+		0x41, 0x41, 0x41, 0x5D, 0x5D, 0x50, 0x5D, 0x5D, 0x50, 0x5D, 0x5D, 0x01, 0x5D, 0x50, 0x41, 0x41,
 	},
 	{
-		0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x6E, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
 	},
 	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x56,
+		0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6E, 0x72, 0x72, 0x72,
 	},
 	{
-		0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
 	},
 	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A,
+		0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6E, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
 	},
 	{
-		0xAA, 0x5A, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0x55,
+		0x72, 0x72, 0x72, 0x72, 0x6E, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
 	},
 	{
-		0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0x56, 0x55,
+		0x72, 0x72, 0x72, 0x72, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
-};
-
-static const uint8_t width1[][32] = {
 	{
-		0, 1, 1, 2, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 3, 1, 1, 1, 1,
+		0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x41, 0x41, 0x41, 0x41, 0x69, 0x69, 0x69, 0x69, 0x69,
 	},
 	{
-		1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 5, 6, 7, 1,
-		8, 1, 9, 10, 1, 1, 11, 12, 13, 14, 15, 1, 1, 16, 1, 17,
+		0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		18, 19, 20, 1, 21, 1, 22, 0, 23, 24, 25, 26, 27, 28, 29, 30,
-		31, 28, 32, 33, 31, 28, 34, 35, 27, 36, 37, 26, 38, 1, 39, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x41,
 	},
 	{
-		40, 41, 42, 26, 27, 36, 43, 26, 44, 45, 29, 26, 27, 1, 46, 1,
-		1, 47, 48, 1, 1, 49, 50, 1, 51, 52, 1, 53, 54, 55, 56, 1,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 57, 58, 59, 60, 1, 1, 1, 61, 61, 61, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 62, 1, 1, 1, 1, 1,
+		0x02, 0x02, 0x02, 0x42, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 63, 64, 64, 64, 1, 65, 66, 1,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x42, 0x42,
 	},
 	{
-		67, 1, 1, 1, 68, 69, 1, 1, 1, 70, 1, 1, 1, 1, 1, 1,
-		71, 1, 72, 73, 1, 14, 74, 1, 75, 76, 38, 77, 44, 78, 1, 79,
+		0x02, 0x02, 0x02, 0x41, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
 	},
 	{
-		1, 80, 1, 1, 1, 1, 81, 82, 1, 1, 1, 1, 1, 1, 0, 0,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x42, 0x41, 0x02, 0x42, 0x02, 0x02, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		67, 83, 1, 84, 1, 1, 14, 85, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 86, 87, 1, 1, 1, 1, 1, 88,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0C,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 89,
-		90, 1, 91, 92, 93, 94, 95, 96, 97, 98, 99, 1, 100, 101, 1, 1,
+		0x41, 0x02, 0x02, 0x02, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x02, 0x02, 0x02, 0x02,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 102, 1, 103, 1, 1, 1, 1, 1,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x42, 0x02,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 104, 1, 1, 1, 2, 1, 1, 1, 0,
-		1, 1, 1, 1, 105, 61, 61, 106, 61, 61, 61, 61, 61, 61, 107, 108,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x02, 0x42, 0x42,
 	},
 	{
-		61, 109, 110, 61, 111, 61, 61, 61, 112, 113, 61, 61, 114, 61, 61, 115,
-		116, 61, 117, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 1, 1,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x51,
 	},
 	{
-		61, 61, 61, 61, 118, 61, 119, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 120, 121, 1, 1, 122, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x0C, 0x0C, 0x0C, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		123, 124, 1, 1, 1, 1, 125, 126, 1, 127, 128, 129, 23, 130, 1, 131,
-		1, 132, 133, 28, 1, 134, 27, 135, 1, 1, 1, 1, 1, 1, 1, 136,
+		0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 137, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 138, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		139, 140, 141, 142, 1, 1, 1, 2, 110, 61, 61, 143, 1, 1, 1, 144,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 145,
-		1, 1, 1, 1, 1, 1, 1, 146, 1, 1, 1, 147, 1, 1, 1, 1,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		148, 149, 1, 1, 1, 1, 1, 68, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 150, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 151, 1, 62, 1, 1, 16, 1, 152, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41,
 	},
 	{
-		27, 153, 154, 155, 44, 156, 157, 1, 23, 158, 1, 159, 44, 160, 161, 1,
-		1, 162, 27, 1, 1, 1, 2, 163, 44, 45, 146, 164, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 153, 165, 1, 1, 166, 167, 1, 1, 1, 1, 1, 1, 168, 169, 1,
-		1, 170, 146, 1, 1, 171, 1, 1, 62, 172, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x01, 0x41, 0x41,
 	},
 	{
-		1, 173, 1, 1, 1, 1, 1, 1, 1, 174, 175, 1, 1, 1, 176, 146,
-		177, 178, 179, 1, 180, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x50, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 181, 1, 1, 182, 183, 1, 1, 1, 184, 185, 1, 186, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 187, 44, 147, 188, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 14, 189, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x5D, 0x50, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 190, 1, 191, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 192, 1, 193, 1, 1, 194,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 195,
+		0x50, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 107, 1, 196, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x01, 0x01, 0x18, 0x01, 0x01,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 197,
+		0x01, 0x01, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x18, 0x41, 0x41,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 198, 199, 200, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 201, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 202, 75, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x50,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 0, 203, 154, 1, 1, 1, 1, 1,
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 204, 205, 206, 1, 1,
-		1, 1, 207, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x01, 0x01, 0x01, 0x01, 0x41, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		0, 208, 0, 209, 210, 211, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x50, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		212, 213, 1, 1, 192, 1, 1, 1, 1, 191, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 214, 1, 215, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 215, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x5D, 0x41, 0x59, 0x59, 0x41, 0x01, 0x01, 0x01, 0x01, 0x50, 0x50, 0x50, 0x50, 0x01, 0x5D, 0x50,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 191, 1, 1, 1, 216, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x01, 0x01, 0x01,
 	},
 	{
-		217, 1, 1, 1, 1, 1, 218, 1, 1, 1, 1, 1, 219, 1, 1, 1,
-		220, 201, 221, 222, 1, 1, 1, 1, 61, 223, 61, 224, 106, 61, 225, 226,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x50,
 	},
 	{
-		61, 116, 227, 61, 61, 61, 61, 228, 61, 229, 230, 231, 232, 217, 1, 233,
-		61, 61, 234, 1, 61, 61, 235, 236, 1, 1, 1, 1, 1, 1, 1, 237,
+		0x50, 0x50, 0x5D, 0x5D, 0x50, 0x5D, 0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x50, 0x41,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 238, 239, 240, 61, 61, 61, 61, 61,
-		1, 1, 1, 241, 242, 243, 244, 245, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 229,
+		0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
 	},
 	{
-		27, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0x50, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x41, 0x5D, 0x5D, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x41, 0x41,
 	},
-};
-
-static const uint8_t width0[] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
-	13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 20,
-	21, 18, 22, 23, 24, 25, 26, 27, 18, 18, 18, 18, 18, 28, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 29, 30, 13, 13, 13, 13,
-	13, 31, 13, 32, 18, 18, 18, 18, 18, 18, 18, 33, 34, 18, 18, 35,
-	18, 18, 18, 36, 37, 18, 38, 18, 39, 40, 41, 18, 42, 43, 44, 18,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 45,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 45,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	46, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-};
-
-static const int width0_shift = 10;
-static const int width1_shift = 5;
-static const int width2_shift = 2;
-static const int width1_mask = 0x1f;
-static const int width2_mask = 0x7;
-static const int width3_mask = 0x3;
-static const int width_val_shift = 2;
-static const int width_val_mask = 0x3;
-
-static const uint8_t grapheme_break2[][8] = {
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_LF << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CR << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_ZWJ << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
+	{
+		0x41, 0x41, 0x5D, 0x5D, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x5D, 0x5D, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x01, 0x50, 0x41,
+	},
+	{
+		0x51, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x5D, 0x5D, 0x51, 0x5D, 0x50,
+	},
+	{
+		0x50, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51,
+	},
+	{
+		0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x5D, 0x50,
+	},
+	{
+		0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x41, 0x41,
+	},
+	{
+		0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x5D, 0x50,
+	},
+	{
+		0x50, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x5D, 0x50, 0x5D, 0x5D,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x01, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x51, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x41, 0x41, 0x50, 0x50, 0x5D, 0x50, 0x59,
+	},
+	{
+		0x5D, 0x59, 0x5D, 0x50, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x5D, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x5D, 0x5D, 0x5D, 0x5D,
+	},
+	{
+		0x50, 0x41, 0x01, 0x41, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x59, 0x50, 0x50, 0x50, 0x50, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5D,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5D, 0x50,
+	},
+	{
+		0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x5D, 0x50, 0x50, 0x5D, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x50, 0x41, 0x50, 0x50, 0x41, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x59, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x41,
+	},
+	{
+		0x50, 0x50, 0x41, 0x5D, 0x5D, 0x50, 0x5D, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x50, 0x50, 0x5D, 0x5D, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x59, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x5D, 0x5D, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x5D, 0x5D,
+	},
+	{
+		0x50, 0x5D, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+	},
+	{
+		0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+	},
+	{
+		0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50,
+	},
+	{
+		0x42, 0x42, 0x02, 0x42, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x5E, 0x5E, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x42, 0x42, 0x41,
+	},
+	{
+		0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x42, 0x42, 0x42, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x01,
+	},
+	{
+		0x0C, 0x0C, 0x0C, 0x0C, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x5D, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x5D, 0x51, 0x51,
+	},
+	{
+		0x51, 0x51, 0x51, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x50, 0x50, 0x41, 0x50, 0x50, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x79, 0x79, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x41,
+	},
+	{
+		0x41, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x41, 0x41, 0x41, 0x41, 0x41,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x42, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7A, 0x42, 0x42, 0x42, 0x42, 0x42,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7A,
+	},
+	{
+		0x42, 0x42, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x42, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7A,
+	},
+	{
+		0x7A, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x52, 0x52, 0x52, 0x52, 0x52,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79,
+	},
+	{
+		0x7A, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x41, 0x41,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x79, 0x79,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x79, 0x79,
+	},
+	{
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x41, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x41, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x7A,
+	},
+	{
+		0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A,
+	},
+	{
+		0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x41, 0x41,
+	},
+	{
+		0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41,
+	},
+	{
+		0x4D, 0x0C, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+	},
+	{
+		0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
 	},
 };
 
-static const uint8_t grapheme_break1[][64] = {
+static const uint16_t props1[][32] = {
 	{
-		0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 1, 2, 3, 4, 5, 4, 6, 1, 1, 7, 8, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
-		10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2, 2, 14, 15, 2,
-		16, 17, 2, 5, 18, 2, 2, 2, 2, 2, 19, 13, 2, 2, 12, 20,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		10, 10, 10, 10, 10, 10, 10, 11, 12, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 21, 22, 2, 2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
-		27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33, 34, 35, 31, 36,
-		37, 2, 2, 38, 39, 17, 2, 40, 37, 2, 2, 38, 41, 2, 31, 25,
-		32, 2, 2, 42, 34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
+		9, 9, 9, 9, 9, 9, 9, 9, 13, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 3, 9, 9, 14, 15, 10, 16, 17, 9, 9, 18,
 	},
 	{
-		47, 2, 2, 42, 48, 49, 31, 2, 32, 2, 2, 50, 51, 49, 31, 52,
-		53, 2, 2, 54, 55, 35, 31, 2, 32, 2, 2, 2, 56, 57, 2, 58,
-		2, 2, 2, 59, 60, 2, 2, 2, 2, 2, 2, 61, 62, 2, 2, 2,
-		2, 63, 2, 64, 2, 2, 2, 65, 66, 67, 5, 68, 69, 2, 2, 2,
+		19, 20, 9, 9, 21, 10, 22, 23, 9, 9, 9, 9, 9, 24, 25, 9,
+		26, 27, 9, 10, 28, 9, 9, 9, 9, 9, 29, 23, 9, 9, 21, 30,
 	},
 	{
-		2, 2, 70, 71, 2, 72, 13, 73, 74, 75, 2, 2, 2, 2, 2, 2,
-		76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 78, 79, 79, 79, 79, 79,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 70, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 31, 32, 33, 9, 34, 9, 9, 9, 35, 9, 9, 36, 10, 37, 10,
+		38, 9, 9, 39, 40, 41, 42, 4, 43, 9, 9, 44, 45, 46, 47, 48,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 80, 2, 81, 2, 31, 2, 31, 2, 2, 2, 82, 83, 20, 2, 2,
+		49, 9, 9, 50, 51, 27, 9, 52, 49, 9, 9, 50, 53, 9, 47, 54,
+		43, 9, 9, 55, 45, 56, 47, 9, 57, 9, 9, 58, 59, 46, 9, 9,
 	},
 	{
-		84, 2, 2, 2, 2, 2, 2, 2, 49, 2, 85, 2, 2, 2, 2, 2,
-		2, 2, 86, 87, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 88, 2, 2, 2, 89, 90, 91, 2, 2, 2, 5, 92, 2, 2, 2,
-		93, 2, 2, 94, 95, 2, 12, 96, 97, 2, 98, 2, 2, 2, 99, 53,
+		60, 9, 9, 61, 62, 63, 47, 12, 64, 9, 9, 65, 66, 67, 47, 68,
+		69, 9, 9, 70, 71, 46, 47, 9, 43, 9, 9, 9, 72, 73, 9, 74,
 	},
 	{
-		2, 2, 100, 101, 2, 2, 2, 2, 2, 2, 2, 2, 2, 102, 103, 104,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 9, 75, 76, 77, 9, 9, 9, 9, 9, 78, 79, 9, 9, 9,
+		80, 81, 9, 82, 9, 9, 9, 83, 84, 85, 10, 86, 87, 88, 9, 9,
 	},
 	{
-		105, 2, 106, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 5, 5, 13,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 89, 90, 3, 91, 23, 92, 93, 94, 9, 9, 9, 9, 9, 95,
+		96, 96, 96, 96, 96, 96, 97, 97, 97, 97, 98, 99, 99, 99, 99, 99,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 89, 100, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 107, 108,
-		2, 2, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 5, 5,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		4, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 25, 2, 2, 2, 2, 2, 2, 109, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 9, 9, 9, 9, 11, 9, 4, 101, 9, 9, 9, 9, 102, 9,
+		9, 103, 9, 104, 9, 47, 9, 47, 9, 9, 9, 105, 106, 107, 9, 9,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 107, 110, 2, 111, 2, 2, 2, 2, 2, 108,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		108, 9, 9, 9, 9, 9, 9, 9, 63, 9, 109, 9, 9, 9, 9, 9,
+		9, 9, 110, 111, 112, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		112, 2, 113, 2, 2, 2, 2, 2, 114, 2, 2, 115, 116, 2, 5, 117,
-		2, 2, 118, 2, 119, 53, 76, 120, 27, 2, 2, 121, 122, 2, 123, 2,
-		2, 2, 124, 125, 126, 2, 2, 127, 2, 2, 2, 128, 17, 2, 129, 130,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 131, 2,
+		9, 113, 9, 9, 9, 114, 115, 116, 9, 9, 117, 10, 118, 9, 9, 9,
+		119, 9, 9, 120, 121, 3, 122, 123, 124, 9, 125, 9, 9, 9, 126, 127,
 	},
 	{
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
+		9, 9, 128, 129, 9, 9, 9, 130, 9, 9, 9, 9, 131, 132, 133, 134,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10,
 	},
 	{
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
+		135, 2, 136, 137, 138, 139, 140, 141, 141, 9, 9, 9, 9, 10, 10, 23,
+		9, 9, 142, 143, 9, 9, 9, 9, 9, 144, 145, 9, 9, 9, 9, 9,
 	},
 	{
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		146, 147, 148, 9, 9, 9, 9, 9, 149, 9, 9, 9, 150, 9, 151, 152,
 	},
 	{
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 142, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 153, 154, 155, 9, 9, 156,
 	},
 	{
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
+		157, 158, 159, 159, 160, 161, 159, 162, 163, 164, 165, 166, 167, 168, 169, 170,
+		171, 172, 173, 174, 175, 176, 177, 178, 9, 179, 180, 181, 182, 9, 183, 9,
 	},
 	{
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 184, 9, 9, 9, 9, 185, 100, 9, 9, 9, 146, 9, 186,
 	},
 	{
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 137, 77, 138, 79, 79, 139,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		187, 188, 9, 9, 9, 189, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 190, 191,
+		9, 9, 9, 9, 9, 9, 9, 192, 9, 9, 9, 9, 9, 9, 10, 10,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 2, 2, 2, 2, 2, 140,
+		2, 2, 33, 2, 2, 193, 9, 9, 194, 195, 194, 194, 194, 194, 194, 196,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 197, 9, 198,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 75,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2,
-		2, 2, 2, 2, 2, 2, 2, 141, 2, 2, 2, 2, 2, 2, 2, 2,
+		199, 200, 201, 202, 203, 194, 194, 194, 194, 204, 205, 194, 194, 194, 194, 206,
+		207, 194, 194, 203, 194, 194, 194, 194, 208, 194, 194, 194, 194, 194, 196, 194,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		142, 2, 2, 143, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		194, 208, 194, 194, 209, 194, 194, 194, 194, 210, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 144, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 145, 2, 2, 2, 2, 70,
-		2, 2, 2, 2, 19, 13, 2, 2, 146, 2, 2, 2, 2, 2, 2, 2,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
 	},
 	{
-		147, 2, 2, 148, 149, 2, 2, 150, 97, 2, 2, 151, 152, 2, 2, 2,
-		153, 2, 154, 155, 156, 2, 2, 157, 97, 2, 2, 158, 159, 2, 2, 2,
-		2, 2, 160, 161, 17, 2, 2, 2, 2, 2, 2, 2, 2, 107, 162, 2,
-		53, 2, 2, 54, 163, 35, 164, 155, 2, 2, 2, 2, 2, 2, 2, 2,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 2, 165, 166, 36, 2, 2, 2, 2, 2, 167, 168, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 107, 169, 13, 170, 2, 2,
-		2, 2, 2, 171, 13, 2, 2, 2, 2, 2, 172, 173, 2, 2, 2, 2,
-		2, 70, 174, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		194, 194, 194, 194, 194, 194, 194, 194, 211, 194, 194, 194, 212, 9, 9, 130,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 160, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 176, 177, 2, 2, 2, 2, 2, 2, 2, 2, 178, 179, 2,
-		180, 2, 2, 181, 35, 182, 2, 2, 183, 184, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		213, 9, 9, 9, 9, 9, 190, 214, 9, 215, 9, 9, 9, 9, 9, 216,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		2, 2, 185, 186, 2, 2, 2, 2, 2, 187, 188, 189, 2, 2, 2, 2,
-		2, 2, 2, 190, 191, 2, 2, 2, 192, 193, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 194,
-		195, 2, 2, 196, 197, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		217, 9, 218, 9, 9, 9, 9, 219, 220, 9, 9, 221, 222, 9, 10, 223,
+		9, 9, 224, 9, 225, 226, 96, 227, 38, 9, 9, 228, 229, 130, 230, 9,
 	},
 	{
-		2, 2, 2, 1, 198, 199, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 231, 232, 233, 234, 9, 235, 9, 9, 9, 236, 27, 130, 237, 238,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 239, 9,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 155,
-		2, 2, 2, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241,
+		242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 107, 200, 201, 201, 202, 153, 2, 2, 2, 2, 203, 114,
+		242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244,
+		242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 204, 205, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242,
+		243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 206, 5, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242,
+		240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 207, 208, 209, 2, 210, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 211, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243,
+		242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 5, 212, 5, 5, 68, 123, 203, 12, 7, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240,
+		241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242,
 	},
 	{
-		213, 214, 215, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 216, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242,
+		244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		240, 241, 242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 244, 242, 240, 241,
+		242, 243, 242, 244, 242, 240, 241, 242, 243, 242, 245, 97, 246, 99, 99, 247,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 149, 2, 2,
-		2, 2, 2, 2, 217, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
 	},
 	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 218, 219,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 12,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		9, 248, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		1, 1, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1,
-		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 130, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
 	},
 	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		10, 249, 10, 250, 251, 252, 253, 9, 9, 9, 9, 9, 9, 9, 9, 254,
+		255, 256, 205, 257, 194, 258, 259, 9, 9, 260, 9, 9, 9, 9, 212, 261,
 	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		262, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 94,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 23, 9,
+		9, 9, 9, 9, 9, 9, 9, 263, 9, 264, 9, 9, 9, 4, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 264, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 12, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 264, 9, 264, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		265, 9, 9, 266, 9, 100, 9, 264, 9, 9, 9, 9, 9, 9, 63, 267,
+		9, 9, 9, 268, 9, 9, 9, 9, 9, 269, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 270, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 271, 9, 9, 9, 9, 89,
+		9, 9, 9, 9, 29, 272, 9, 9, 273, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		274, 9, 9, 275, 276, 9, 9, 277, 124, 9, 9, 278, 279, 9, 9, 9,
+		280, 9, 281, 282, 283, 9, 9, 284, 124, 9, 9, 285, 286, 287, 9, 9,
+	},
+	{
+		9, 9, 288, 289, 27, 9, 9, 9, 9, 9, 290, 9, 9, 190, 291, 9,
+		69, 9, 9, 70, 292, 46, 293, 282, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 294, 295, 296, 9, 9, 9, 9, 9, 297, 298, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 299, 300, 301, 302, 9, 9,
+	},
+	{
+		9, 9, 9, 303, 304, 9, 305, 9, 9, 9, 306, 307, 9, 9, 9, 9,
+		9, 89, 308, 309, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 288, 310, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 311, 312, 9, 9, 9, 9, 9, 9, 9, 9, 313, 314, 9,
+	},
+	{
+		315, 9, 9, 316, 317, 318, 9, 9, 319, 320, 262, 9, 9, 9, 9, 9,
+		321, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 322, 323, 324, 9, 9, 325, 9, 326, 327, 328, 9, 9, 9, 9,
+		9, 9, 9, 329, 330, 9, 9, 9, 331, 332, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 333,
+		334, 9, 9, 335, 336, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 264,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 337, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 338,
+	},
+	{
+		9, 9, 9, 1, 339, 340, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 130, 9, 9, 9, 9, 9, 9, 9, 9, 341,
+		9, 9, 9, 342, 343, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 344, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 190, 345, 346, 346, 347, 280, 9, 9, 9, 9, 348, 349,
+	},
+	{
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 209,
+	},
+	{
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 197, 9, 9,
+		350, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 351,
+	},
+	{
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 352, 353, 9, 354, 355, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+	},
+	{
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 198,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 356, 357, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		10, 10, 358, 10, 359, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 360, 361, 362, 9, 363, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 364, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		10, 10, 10, 365, 10, 10, 86, 230, 366, 21, 15, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		367, 368, 369, 9, 9, 9, 9, 9, 190, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 359, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 248, 9, 9, 9, 370, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 370, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 359, 9, 9,
+		9, 9, 9, 9, 371, 130, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		168, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 162, 159, 159, 159,
+		372, 9, 150, 9, 9, 9, 373, 374, 375, 376, 372, 159, 159, 159, 377, 378,
+	},
+	{
+		379, 380, 381, 382, 383, 384, 385, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		386, 386, 387, 388, 386, 386, 386, 389, 386, 161, 386, 386, 390, 161, 386, 391,
+	},
+	{
+		386, 386, 386, 392, 393, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 394,
+		386, 386, 386, 395, 396, 386, 397, 169, 159, 398, 168, 159, 159, 159, 159, 399,
+	},
+	{
+		386, 386, 386, 386, 386, 9, 9, 9, 386, 386, 386, 386, 400, 401, 402, 403,
+		9, 9, 9, 9, 9, 9, 9, 404, 9, 9, 9, 9, 9, 405, 406, 407,
+	},
+	{
+		373, 9, 9, 9, 408, 409, 9, 9, 408, 9, 410, 159, 159, 159, 159, 159,
+		411, 386, 386, 412, 413, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386,
+	},
+	{
+		159, 159, 159, 159, 159, 159, 159, 414, 415, 386, 386, 416, 417, 406, 415, 415,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	},
+	{
+		159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+	},
+	{
+		159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 418,
+	},
+	{
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 419,
+	},
+	{
+		420, 421, 422, 422, 422, 422, 422, 422, 421, 421, 421, 421, 421, 421, 421, 421,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 421,
+	},
+	{
+		421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421,
+		421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421,
+	},
+};
+
+static const uint8_t props0[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34,
+	35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 40, 41, 42, 43,
+	44, 45, 46, 15, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+	15, 15, 59, 15, 15, 15, 15, 60, 15, 15, 61, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 62, 15, 63, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 64, 26, 26, 65, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 66, 67, 68, 15, 15, 15, 15, 69, 15,
+	15, 15, 15, 15, 15, 15, 15, 70, 71, 72, 15, 15, 15, 73, 15, 15,
+	74, 75, 76, 15, 77, 15, 15, 15, 78, 79, 80, 81, 82, 83, 84, 85,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 86,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 86,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	87, 88, 88, 88, 88, 88, 88, 88, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
 };
 
-static const uint8_t grapheme_break0[] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 12, 13, 14, 15, 16, 17, 18,
-	19, 20, 14, 15, 16, 21, 9, 9, 9, 9, 9, 9, 9, 9, 22, 23,
-	24, 9, 25, 26, 27, 28, 29, 30, 9, 9, 9, 9, 9, 31, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 32, 33, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 34,
-	9, 9, 9, 35, 36, 9, 37, 9, 38, 39, 40, 9, 41, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	42, 43, 43, 43, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+static const uint8_t props_latin1[] = {
+	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x08, 0x0C, 0x0C, 0x04, 0x0C, 0x0C,
+	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x41,
+	0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x01, 0x01, 0x0C,
+	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+	0x01, 0x01, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x41, 0x79, 0x41, 0x01, 0x41, 0x0D, 0x79, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x01, 0x41, 0x41, 0x41, 0x01, 0x41, 0x41, 0x41, 0x01,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
 };
 
-static const int grapheme_break0_shift = 10;
-static const int grapheme_break1_shift = 4;
-static const int grapheme_break2_shift = 1;
-static const int grapheme_break1_mask = 0x3f;
-static const int grapheme_break2_mask = 0x7;
-static const int grapheme_break3_mask = 0x1;
-static const int grapheme_break_val_shift = 4;
-static const int grapheme_break_val_mask = 0xf;
+static const int props0_shift = 9;
+static const int props1_shift = 4;
+static const int props1_mask = 0x1f;
+static const int props2_mask = 0xf;
@@ -1,9 +1,31 @@
-#!/usr/bin/env python
-# Build multi-stage lookup tables for character widths and grapheme break properties
+#!/usr/bin/env python3
+# Build a multi-stage lookup table of the width, grapheme break class and word
+# class of each character, and the state machine that finds grapheme cluster
+# breaks
+import argparse
+import os
 import re
+import sys
+
+parser = argparse.ArgumentParser(
+    description='Generate the Unicode tables included by utf8.c, reporting their size on stderr.')
+parser.add_argument('--data-dir',
+    default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'utf8data'),
+    help='directory holding the UCD files (default: %(default)s)')
+parser.add_argument('--block1-bits', type=int, default=5,
+    help='bits of a codepoint that index a block of the middle level (default: %(default)s)')
+parser.add_argument('--block2-bits', type=int, default=4,
+    help='bits of a codepoint that index a block of the last level (default: %(default)s)')
+parser.add_argument('--compact', action='store_true',
+    help='emit lists of ranges searched by bisection instead of the multi-stage '
+        'table, which are smaller but slower to look up')
+args = parser.parse_args()
+
+def ucd_open(name):
+    return open(os.path.join(args.data_dir, name), encoding='utf-8')
 
 CatCode = dict()
-with open('UnicodeData.txt') as f:
+with ucd_open('UnicodeData.txt') as f:
     for line in f.readlines():
         tokens = line.split(';')
         if len(tokens) < 3:
@@ -20,7 +42,7 @@ with open('UnicodeData.txt') as f:
             CatCode[c] = tokens[2]
 
 EastAsianWidth = dict()
-with open('EastAsianWidth.txt') as f:
+with ucd_open('EastAsianWidth.txt') as f:
     for line in f.readlines():
         tokens = line.split('#')[0].split(';')
         if len(tokens) < 2:
@@ -41,7 +63,7 @@ with open('EastAsianWidth.txt') as f:
                 EastAsianWidth[c] = 1
 
 GraphemeBreak = dict()
-with open('GraphemeBreakProperty.txt') as f:
+with ucd_open('GraphemeBreakProperty.txt') as f:
     for line in f.readlines():
         tokens = line.split('#')[0].split(';')
         if len(tokens) < 2:
@@ -58,6 +80,23 @@ with open('GraphemeBreakProperty.txt') as f:
         for c in range(start, end + 1):
             GraphemeBreak[c] = b
 
+ExtendedPictographic = set()
+with ucd_open('emoji-data.txt') as f:
+    for line in f.readlines():
+        tokens = line.split('#')[0].split(';')
+        if len(tokens) < 2 or tokens[1].strip() != 'Extended_Pictographic':
+            continue
+
+        rangetokens = tokens[0].split('..')
+        start = int(rangetokens[0], 16)
+        if len(rangetokens) > 1:
+            end = int(rangetokens[1], 16)
+        else:
+            end = start
+
+        for c in range(start, end + 1):
+            ExtendedPictographic.add(c)
+
 def width(c):
     if c == 0x00ad:
         return 1
@@ -66,65 +105,196 @@ def width(c):
         return 0
     return EastAsianWidth.get(c, 1)
 
+# Extended_Pictographic is a separate property, but as those characters
+# otherwise have no grapheme break property it can be treated as one more
 def grapheme_break(c):
-    return GraphemeBreak.get(c, 'Other')
+    b = GraphemeBreak.get(c, 'Other')
+    if c in ExtendedPictographic:
+        assert b == 'Other'
+        return 'Extended_Pictographic'
+    return b
+
+# The order of the grapheme break classes, as they're numbered in the tables
+GraphemeBreakClasses = [
+    'Other', 'CR', 'LF', 'Control', 'Extend', 'Regional_Indicator', 'Prepend',
+    'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT', 'ZWJ', 'Extended_Pictographic',
+]
+
+# Words, for moving and deleting by words, are separated by spaces, controls
+# and punctuation other than connectors such as '_'. Symbols are part of words
+# too, bar those in ASCII such as '=' and '|', which also keeps the table small
+WordClasses = ['Other', 'Word']
+
+def word_class(c):
+    if c < 0x80:
+        if chr(c).isalnum() or chr(c) == '_':
+            return 'Word'
+        return 'Other'
+    cat = CatCode.get(c, 'Cn')
+    if (cat[0] in ('Z', 'P') and cat != 'Pc') or cat in ('Cc', 'Cf'):
+        return 'Other'
+    return 'Word'
+
+# Each codepoint's properties are packed into a byte, with the width in the
+# low bits, the grapheme break class above it and the word class above that
+props_width_bits = 2
+props_break_bits = 4
+props_word_bits = 1
+
+GraphemeBreakIndex = dict([(b, i) for i, b in enumerate(GraphemeBreakClasses)])
+WordIndex = dict([(w, i) for i, w in enumerate(WordClasses)])
+
+def props(c):
+    return ((WordIndex[word_class(c)] << (props_width_bits + props_break_bits))
+        | (GraphemeBreakIndex[grapheme_break(c)] << props_width_bits)
+        | width(c))
+
+# The state of the segmenter is what it needs to know of the text so far
+# to decide whether there's a break before the next character
+GraphemeStates = [
+    'Other', 'CR', 'Control', 'L', 'V', 'T', 'Prepend',
+    'Regional_Indicator',       # An odd number of them in a row
+    'Extended_Pictographic',    # Followed by any Extend
+    'Extended_Pictographic_ZWJ',
+]
+
+# Whether there's a break between the text so far and a character of class 'b'
+def grapheme_break_before(state, b):
+    # GB3
+    if state == 'CR' and b == 'LF':
+        return False
+    # GB4
+    if state in ('CR', 'Control'):
+        return True
+    # GB5
+    if b in ('Control', 'CR', 'LF'):
+        return True
+    # GB6
+    if state == 'L' and b in ('L', 'V', 'LV', 'LVT'):
+        return False
+    # GB7
+    if state == 'V' and b in ('V', 'T'):
+        return False
+    # GB8
+    if state == 'T' and b == 'T':
+        return False
+    # GB9, GB9a
+    if b in ('Extend', 'ZWJ', 'SpacingMark'):
+        return False
+    # GB9b
+    if state == 'Prepend':
+        return False
+    # GB11
+    if state == 'Extended_Pictographic_ZWJ' and b == 'Extended_Pictographic':
+        return False
+    # GB12, GB13
+    if state == 'Regional_Indicator' and b == 'Regional_Indicator':
+        return False
+    # GB999
+    return True
+
+def grapheme_next_state(state, b):
+    if b == 'CR':
+        return 'CR'
+    if b in ('LF', 'Control'):
+        return 'Control'
+    if b == 'L':
+        return 'L'
+    if b in ('V', 'LV'):
+        return 'V'
+    if b in ('T', 'LVT'):
+        return 'T'
+    if b == 'Prepend':
+        return 'Prepend'
+    if b == 'Regional_Indicator':
+        # The second of a pair ends it
+        if state == 'Regional_Indicator':
+            return 'Other'
+        return 'Regional_Indicator'
+    if b == 'Extended_Pictographic':
+        return 'Extended_Pictographic'
+    if b == 'Extend' and state == 'Extended_Pictographic':
+        return 'Extended_Pictographic'
+    if b == 'ZWJ' and state == 'Extended_Pictographic':
+        return 'Extended_Pictographic_ZWJ'
+    return 'Other'
+
+# Each entry of the table holds the next state, with the top bit set if
+# there's a break before the character
+grapheme_dfa_break = 0x80
+
+def grapheme_dfa():
+    assert len(GraphemeStates) < grapheme_dfa_break
+    print('static const uint8_t grapheme_dfa[][%d] = {' % len(GraphemeBreakClasses))
+    for state in GraphemeStates:
+        vals = []
+        for b in GraphemeBreakClasses:
+            val = GraphemeStates.index(grapheme_next_state(state, b))
+            if grapheme_break_before(state, b):
+                val |= grapheme_dfa_break
+            vals.append('0x%02X' % val)
+        print('\t{ ' + ', '.join(vals) + ' },\t/* %s */' % state)
+    print('};\n')
+    print('static const int grapheme_dfa_break = 0x%02x;' % grapheme_dfa_break)
+    print('static const int grapheme_dfa_state_mask = 0x%02x;' % (grapheme_dfa_break - 1))
+    print('')
+
+    sys.stderr.write('grapheme_dfa: %d bytes\n' % (len(GraphemeStates) * len(GraphemeBreakClasses)))
+
+def index_type(count):
+    if count <= 0x100:
+        return 'uint8_t', 1
+    return 'uint16_t', 2
 
 class LookupTable(object):
-    def __init__(self, label, row_len, val_bits, display_val):
+    def __init__(self, label, row_len, display_val):
         self.label = label
         self.row_len = row_len
-        self.val_len = 1 << val_bits
-        self.val_shift = 8 / self.val_len
         self.display_val = display_val
         self.blocks = []
+        self.indexes = dict()
 
     def append(self, block):
-        try:
-            index = self.blocks.index(block)
-        except ValueError:
+        block = tuple(block)
+        index = self.indexes.get(block)
+        if index is None:
             index = len(self.blocks)
             self.blocks.append(block)
+            self.indexes[block] = index
         return index
 
-    def display(self):
-        print 'static const uint8_t %s[][%d] = {' % (self.label, len(self.blocks[0])/self.val_len)
+    def size(self, val_size):
+        return len(self.blocks) * len(self.blocks[0]) * val_size
+
+    def display(self, val_type):
+        print('static const %s %s[][%d] = {' % (val_type, self.label, len(self.blocks[0])))
         for block in self.blocks:
             self.display_block(block)
-        print '};\n'
+        print('};\n')
 
     def display_block(self, block):
-        print '\t{'
+        print('\t{')
         for i in range(0, len(block), self.row_len):
-            self.display_row(block[i:i+self.row_len])
-        print '\t},'
-
-    def display_row(self, row):
-        vals = []
-        for i in range(0, len(row), self.val_len):
-            vals.append(self.display_val(row[i:i+self.val_len], self.val_shift))
-        print '\t\t' + ', '.join(vals) + ','
-
-def display_index(val, val_shift):
-    return '%d' % sum([v << (i * val_shift) for i,v in enumerate(val)])
+            print('\t\t' + ', '.join(map(self.display_val, block[i:i+self.row_len])) + ',')
+        print('\t},')
 
-def display_width(val, val_shift):
-    return '0x%02X' % sum([v << (i * val_shift) for i,v in enumerate(val)])
+def display_index(val):
+    return '%d' % val
 
-def display_grapheme_break(val, val_shift):
-    return ' | '.join(['(UTF8_GRAPHEME_BREAK_' + v.upper() + ' << ' + str(i * val_shift) + ')' for i,v in enumerate(val)])
+def display_props(val):
+    return '0x%02X' % val
 
-def display_index_table(label, val):
-    print 'static const uint8_t ' + label + '[] = {'
+def display_flat_table(label, val_type, val, display_val):
+    print('static const %s %s[] = {' % (val_type, label))
     for i in range(0, len(val), 0x10):
-        print '\t' + ', '.join(map(str, val[i:i+0x10])) + ','
-    print '};\n'
-
-def table(label, f, display, row_len, count, block1_bits, block2_bits, val_bits):
-    val_shift = 8 / (1 << val_bits)
-    table1 = LookupTable(label + str(1), 16, 0, display_index)
-    table2 = LookupTable(label + str(2), row_len, val_bits, display)
-    block1_len = 1 << (block1_bits + block2_bits + val_bits);
-    block2_len = 1 << (block2_bits + val_bits);
+        print('\t' + ', '.join(map(display_val, val[i:i+0x10])) + ',')
+    print('};\n')
+
+def table(label, f, display, count, block1_bits, block2_bits):
+    table1 = LookupTable(label + str(1), 16, display_index)
+    table2 = LookupTable(label + str(2), 16, display)
+    block1_len = 1 << (block1_bits + block2_bits)
+    block2_len = 1 << block2_bits
     indextable = []
     for i in range(0, count, block1_len):
         block1 = []
@@ -135,18 +305,97 @@ def table(label, f, display, row_len, count, block1_bits, block2_bits, val_bits)
             block1.append(table2.append(block2))
         indextable.append(table1.append(block1))
 
-    table2.display()
-    table1.display()
-    display_index_table(label + str(0), indextable)
-    print 'static const int %s0_shift = %d;' % (label, block1_bits + block2_bits + val_bits)
-    print 'static const int %s1_shift = %d;' % (label, block2_bits + val_bits)
-    print 'static const int %s2_shift = %d;' % (label, val_bits)
-    print 'static const int %s1_mask = 0x%x;' % (label, (1 << block1_bits) - 1)
-    print 'static const int %s2_mask = 0x%x;' % (label, (1 << block2_bits) - 1)
-    print 'static const int %s3_mask = 0x%x;' % (label, (1 << val_bits) - 1)
-    print 'static const int %s_val_shift = %d;' % (label, val_shift)
-    print 'static const int %s_val_mask = 0x%x;' % (label, (1 << val_shift) - 1)
-
-table('width', width, display_width, 32, 0x110000, 5, 3, 2)
-print ''
-table('grapheme_break', grapheme_break, display_grapheme_break, 2, 0x110000, 6, 3, 1)
+    # The first 256 codepoints are looked up directly
+    latin1 = [f(c) for c in range(0x100)]
+
+    type1, size1 = index_type(len(table2.blocks))
+    type0, size0 = index_type(len(table1.blocks))
+    sizes = [
+        ('%s0' % label, len(indextable) * size0),
+        ('%s1' % label, table1.size(size1)),
+        ('%s2' % label, table2.size(1)),
+        ('%s_latin1' % label, len(latin1)),
+    ]
+    total = sum([size for name, size in sizes])
+
+    print('/* %s: %d bytes (%s) */\n' % (label, total,
+        ', '.join(['%s %d' % (name, size) for name, size in sizes])))
+    table2.display('uint8_t')
+    table1.display(type1)
+    display_flat_table(label + str(0), type0, indextable, display_index)
+    display_flat_table(label + '_latin1', 'uint8_t', latin1, display)
+    print('static const int %s0_shift = %d;' % (label, block1_bits + block2_bits))
+    print('static const int %s1_shift = %d;' % (label, block2_bits))
+    print('static const int %s1_mask = 0x%x;' % (label, (1 << block1_bits) - 1))
+    print('static const int %s2_mask = 0x%x;' % (label, (1 << block2_bits) - 1))
+
+    sys.stderr.write('%s: %d bytes, block1_bits %d, block2_bits %d\n' %
+        (label, total, block1_bits, block2_bits))
+    for name, size in sizes:
+        sys.stderr.write('  %-16s %6d\n' % (name, size))
+
+# Lists of the ranges of codepoints with the same properties, one for the
+# rest of the BMP with 16 bit starts and one for the other planes with each
+# start and its properties packed into 32 bits, after the first 256
+def compact_table(label, f, display, count):
+    latin1 = [f(c) for c in range(0x100)]
+    bmp_starts = []
+    bmp = []
+    astral = []
+    prev = None
+    for c in range(0x100, count):
+        val = f(c)
+        if c == 0x10000:
+            prev = None
+        if val == prev:
+            continue
+        prev = val
+        if c < 0x10000:
+            bmp_starts.append(c)
+            bmp.append(val)
+        else:
+            astral.append((c << 8) | val)
+
+    sizes = [
+        ('%s_bmp_start' % label, len(bmp_starts) * 2),
+        ('%s_bmp' % label, len(bmp)),
+        ('%s_astral' % label, len(astral) * 4),
+        ('%s_latin1' % label, len(latin1)),
+    ]
+    total = sum([size for name, size in sizes])
+
+    print('/* %s: %d bytes (%s) */\n' % (label, total,
+        ', '.join(['%s %d' % (name, size) for name, size in sizes])))
+    print('#define UTF8DATA_COMPACT\n')
+    display_flat_table(label + '_bmp_start', 'uint16_t', bmp_starts, lambda val: '0x%04X' % val)
+    display_flat_table(label + '_bmp', 'uint8_t', bmp, display)
+    display_flat_table(label + '_astral', 'uint32_t', astral, lambda val: '0x%08X' % val)
+    display_flat_table(label + '_latin1', 'uint8_t', latin1, display)
+
+    sys.stderr.write('%s: %d bytes, compact\n' % (label, total))
+    for name, size in sizes:
+        sys.stderr.write('  %-16s %6d\n' % (name, size))
+
+print('enum {')
+for b in GraphemeBreakClasses:
+    print('\tUTF8_GRAPHEME_BREAK_%s,' % b.upper())
+print('};\n')
+print('static const int props_width_mask = 0x%x;' % ((1 << props_width_bits) - 1))
+print('static const int props_break_shift = %d;' % props_width_bits)
+print('static const int props_break_mask = 0x%x;' % ((1 << props_break_bits) - 1))
+print('')
+print('enum {')
+for w in WordClasses:
+    print('\tUTF8_WORD_CLASS_%s,' % w.upper())
+print('};\n')
+print('static const int props_word_shift = %d;' % (props_width_bits + props_break_bits))
+print('static const int props_word_mask = 0x%x;' % ((1 << props_word_bits) - 1))
+print('')
+assert len(GraphemeBreakClasses) <= (1 << props_break_bits)
+assert len(WordClasses) <= (1 << props_word_bits)
+assert props_width_bits + props_break_bits + props_word_bits <= 8
+grapheme_dfa()
+if args.compact:
+    compact_table('props', props, display_props, 0x110000)
+else:
+    table('props', props, display_props, 0x110000, args.block1_bits, args.block2_bits)
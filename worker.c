@@ -0,0 +1,140 @@
+#include "worker.h"
+#include "export.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+typedef struct worker_job_st worker_job_st;
+
+struct worker_job_st {
+	worker_job_st *next;
+	worker_job_cb job;
+	void *arg;
+};
+
+struct worker_pool_st {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	/* Jobs are run in the order they were submitted. */
+	worker_job_st *head;
+	worker_job_st **tail;
+	bool stopping;
+	size_t num_threads;
+	pthread_t threads[];
+};
+
+static void *
+worker_thread(void * const arg)
+{
+	worker_pool_st * const pool = arg;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (pool->head == NULL && !pool->stopping) {
+			pthread_cond_wait(&pool->cond, &pool->lock);
+		}
+
+		worker_job_st * const job = pool->head;
+
+		if (job == NULL) {
+			break;
+		}
+		pool->head = job->next;
+		if (pool->head == NULL) {
+			pool->tail = &pool->head;
+		}
+
+		pthread_mutex_unlock(&pool->lock);
+		job->job(job->arg);
+		free(job);
+		pthread_mutex_lock(&pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+static void
+worker_pool_stop(worker_pool_st * const pool, size_t const num_threads)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stopping = true;
+	pthread_cond_broadcast(&pool->cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (size_t i = 0; i < num_threads; i++) {
+		pthread_join(pool->threads[i], NULL);
+	}
+}
+
+NO_EXPORT
+worker_pool_st *
+worker_pool_new(size_t const num_threads)
+{
+	worker_pool_st * const pool =
+		calloc(1, sizeof(*pool) + sizeof(pool->threads[0]) * num_threads);
+
+	if (pool == NULL) {
+		return NULL;
+	}
+
+	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+		free(pool);
+		return NULL;
+	}
+	if (pthread_cond_init(&pool->cond, NULL) != 0) {
+		pthread_mutex_destroy(&pool->lock);
+		free(pool);
+		return NULL;
+	}
+	pool->tail = &pool->head;
+	pool->num_threads = num_threads;
+
+	for (size_t i = 0; i < num_threads; i++) {
+		if (pthread_create(&pool->threads[i], NULL, worker_thread, pool) != 0) {
+			worker_pool_stop(pool, i);
+			pthread_cond_destroy(&pool->cond);
+			pthread_mutex_destroy(&pool->lock);
+			free(pool);
+			return NULL;
+		}
+	}
+
+	return pool;
+}
+
+NO_EXPORT
+void
+worker_pool_free(worker_pool_st * const pool)
+{
+	if (pool == NULL) {
+		return;
+	}
+
+	worker_pool_stop(pool, pool->num_threads);
+	pthread_cond_destroy(&pool->cond);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool);
+}
+
+NO_EXPORT
+bool
+worker_pool_submit(worker_pool_st * const pool, worker_job_cb const job, void * const arg)
+{
+	worker_job_st * const new_job = malloc(sizeof(*new_job));
+
+	if (new_job == NULL) {
+		return false;
+	}
+	new_job->next = NULL;
+	new_job->job = job;
+	new_job->arg = arg;
+
+	pthread_mutex_lock(&pool->lock);
+	*pool->tail = new_job;
+	pool->tail = &new_job->next;
+	pthread_cond_signal(&pool->cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	return true;
+}
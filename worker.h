@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct worker_pool_st worker_pool_st;
+
+typedef void (*worker_job_cb)(void *arg);
+
+worker_pool_st *
+worker_pool_new(size_t num_threads);
+
+/* Run any jobs still queued, then stop the threads and free the pool. */
+void
+worker_pool_free(worker_pool_st *pool);
+
+/* Queue 'job' to be run with 'arg' on one of the pool's threads. */
+bool
+worker_pool_submit(worker_pool_st *pool, worker_job_cb job, void *arg);